@@ -85,6 +85,7 @@ namespace Mosaic::Internal::Windowing
         EventManager& mEventManager;
 
         friend class Mosaic::Internal::Application;
+        friend class Mosaic::Internal::Rendering::Renderer;
         friend class Mosaic::Internal::Rendering::VulkanRenderer;
         friend class Mosaic::Internal::Rendering::VulkanSurface;
         friend class Mosaic::Internal::Rendering::VulkanInstance;
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "rendering/commands.hpp"
+#include "rendering/meshfile.hpp"
+
+#include "utilities/mappedfile.hpp"
+#include "utilities/numerics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    enum class CapturedCommandType : Types::UI32
+    {
+        VSyncGet,
+        VSyncSet,
+        SwapColourGet,
+        SwapColourSet,
+        RenderPass,
+        Buffer,
+        Shader,
+        Pipeline,
+        Draw,
+    };
+
+    struct CapturedCommand
+    {
+        CapturedCommandType Type;
+        Types::UI32 Object;
+        Types::UI64 Key;
+
+        std::array<Types::UI32, 4> Payload;
+    };
+
+    struct CapturedShader
+    {
+        Types::UI32 Stage;
+        Types::UI32 Reserved;
+
+        MeshFileSection Code;
+        MeshFileSection EntryPoint;
+    };
+
+    struct CapturedPipeline
+    {
+        Types::UI32 Topology;
+        Types::UI32 Cull;
+        Types::UI32 Blend;
+        Types::UI32 DepthTest;
+        Types::UI32 DepthWrite;
+        Types::UI32 DepthCompare;
+        Types::UI32 DepthFormat;
+        Types::UI32 SampleCount;
+        Types::UI32 Layout;
+        Types::UI32 Reserved;
+
+        MeshFileSection Shaders;
+        MeshFileSection Attributes;
+        MeshFileSection ColourFormats;
+    };
+
+    struct CaptureFileHeader
+    {
+        std::array<char, 4> Magic;
+        Types::UI32 Version;
+
+        Types::UI64 FileSize;
+
+        Types::UI32 FrameCount;
+        Types::UI32 MeshCount;
+        Types::UI32 PipelineCount;
+        Types::UI32 ShaderCount;
+        Types::UI32 BufferCount;
+        Types::UI32 RenderPassCount;
+
+        MeshFileSection Frames;
+        MeshFileSection Commands;
+        MeshFileSection Meshes;
+        MeshFileSection Shaders;
+        MeshFileSection Pipelines;
+    };
+
+    class CommandCapture
+    {
+    public:
+        static constexpr std::array<char, 4> Magic = {'M', 'C', 'A', 'P'};
+        static constexpr Types::UI32 Version = 2;
+        static constexpr Types::UI32 NullShader = ~0u;
+
+        void Begin(const std::string& path, Types::UI32 frameCount);
+        void End();
+
+        bool IsCapturing() const;
+
+        void RecordFrame(std::span<const RendererCommandEntry> entries);
+
+    private:
+        CapturedCommand Capture(const RendererCommandWrapper& command);
+
+        Types::UI32 RegisterMesh(const Mesh& mesh);
+        Types::UI32 RegisterShader(const Shader& shader);
+        Types::UI32 RegisterPipeline(const Pipeline& pipeline);
+
+        static Types::UI64 HashMeshContent(const Mesh& mesh);
+        static Types::UI32 Register(const void* object, std::unordered_map<const void*, Types::UI32>& objects);
+
+        std::string mPath;
+
+        Types::UI32 mRemainingFrames = 0;
+
+        std::vector<CapturedCommand> mCommands;
+        std::vector<Types::UI64> mFrameOffsets;
+        std::vector<std::vector<std::byte>> mMeshData;
+        std::vector<Shader> mShaderData;
+        std::vector<PipelineSnapshot> mPipelineData;
+
+        std::unordered_map<Types::UI64, Types::UI32> mMeshes;
+        std::unordered_map<Types::UI64, Types::UI32> mFrameMeshes;
+        std::unordered_map<Types::UI64, Types::UI32> mPipelines;
+        std::unordered_map<Types::UI64, Types::UI32> mShaders;
+        std::unordered_map<const void*, Types::UI32> mBuffers;
+        std::unordered_map<const void*, Types::UI32> mRenderPasses;
+    };
+
+    class CommandReplay
+    {
+    public:
+        void Load(const std::string& path);
+
+        Types::UI32 GetFrameCount() const;
+        Types::UI64 GetSkippedCommands() const;
+
+        void Submit(Types::UI32 frame, RendererCommandManager& manager);
+
+    private:
+        void LoadShaders(std::span<const std::byte> file, const CaptureFileHeader& header, const std::string& path);
+        void LoadPipelines(std::span<const std::byte> file, const CaptureFileHeader& header, const std::string& path);
+
+        std::shared_ptr<const Files::MappedFile> mMapping;
+
+        std::span<const CapturedCommand> mCommands;
+        std::span<const Types::UI64> mFrameOffsets;
+
+        std::vector<std::unique_ptr<Mesh>> mMeshes;
+        std::vector<Pipeline> mPipelines;
+        std::vector<Shader> mShaders;
+        std::vector<Buffer> mBuffers;
+        std::vector<std::shared_ptr<VertexFormat>> mFormats;
+
+        RendererVSync mVSyncWriteback;
+        Types::Vec4<Types::F32> mSwapColourWriteback;
+
+        Types::UI64 mSkippedCommands = 0;
+    };
+}
@@ -4,12 +4,19 @@
 #include "rendering/pass.hpp"
 #include "rendering/pipeline.hpp"
 
+#include "utilities/memory.hpp"
+
+#include <memory>
+#include <span>
+#include <string>
 #include <variant>
 #include <vector>
 
 namespace Mosaic::Internal::Rendering
 {
     class Renderer;
+    class NullRenderer;
+    class CommandCapture;
 
     enum class RendererVSync : Types::I32;
 
@@ -19,6 +26,26 @@ namespace Mosaic::Internal::Rendering
         Set,
     };
 
+    struct CommandSortKey
+    {
+        Types::UI8 Layer = 0;
+        Types::UI8 Pass = 0;
+        Types::UI16 Pipeline = 0;
+        Types::UI16 Material = 0;
+        Types::UI32 Depth = 0;
+
+        Types::UI64 Encode() const;
+
+        static CommandSortKey Decode(Types::UI64 key);
+        static Types::UI32 QuantiseDepth(Types::F32 depth, bool backToFront = false);
+
+        static constexpr Types::UI32 LayerBits = 8;
+        static constexpr Types::UI32 PassBits = 8;
+        static constexpr Types::UI32 PipelineBits = 12;
+        static constexpr Types::UI32 MaterialBits = 12;
+        static constexpr Types::UI32 DepthBits = 24;
+    };
+
     template <CommandAction Action, typename T>
     struct RendererCommand
     {
@@ -32,6 +59,8 @@ namespace Mosaic::Internal::Rendering
 
     private:
         RendererVSync& Writeback;
+
+        friend class CommandCapture;
     };
 
     template <>
@@ -42,6 +71,8 @@ namespace Mosaic::Internal::Rendering
 
     private:
         RendererVSync Request;
+
+        friend class CommandCapture;
     };
 
     template <>
@@ -52,6 +83,8 @@ namespace Mosaic::Internal::Rendering
 
     private:
         Types::Vec4<Types::F32>& Writeback;
+
+        friend class CommandCapture;
     };
 
     template <>
@@ -62,6 +95,8 @@ namespace Mosaic::Internal::Rendering
 
     private:
         Types::Vec4<Types::F32> Request;
+
+        friend class CommandCapture;
     };
 
     template <>
@@ -71,7 +106,9 @@ namespace Mosaic::Internal::Rendering
         RendererCommand(RenderPass& pass);
 
     private:
-        RenderPass& RenderPass;
+        RenderPass& mPass;
+
+        friend class CommandCapture;
     };
 
     template <>
@@ -82,6 +119,9 @@ namespace Mosaic::Internal::Rendering
 
     private:
         Buffer& mBuffer;
+
+        friend class RendererCommandManager;
+        friend class CommandCapture;
     };
 
     template <>
@@ -92,6 +132,10 @@ namespace Mosaic::Internal::Rendering
 
     private:
         Pipeline& mPipeline;
+
+        friend class Renderer;
+        friend class RendererCommandManager;
+        friend class CommandCapture;
     };
 
     template <>
@@ -102,16 +146,37 @@ namespace Mosaic::Internal::Rendering
 
     private:
         Shader& mShader;
+
+        friend class Renderer;
+        friend class RendererCommandManager;
+        friend class CommandCapture;
+    };
+
+    template <>
+    class RendererCommand<CommandAction::Set, Mesh>
+    {
+    public:
+        RendererCommand(Mesh& mesh, Types::UI32 instanceCount = 1);
+
+    private:
+        Mesh& mMesh;
+
+        Types::UI64 mMeshID;
+        Types::UI32 mInstanceCount;
+
+        friend class Renderer;
+        friend class CommandCapture;
     };
 
     using VSyncStateGetCommand = RendererCommand<CommandAction::Get, RendererVSync>;
     using VSyncStateSetCommand = RendererCommand<CommandAction::Set, RendererVSync>;
-    using SwapColourGetCommand = RendererCommand<CommandAction::Get, Types::Vec2<Types::F32>>;
-    using SwapColourSetCommand = RendererCommand<CommandAction::Set, Types::Vec2<Types::F32>>;
+    using SwapColourGetCommand = RendererCommand<CommandAction::Get, Types::Vec4<Types::F32>>;
+    using SwapColourSetCommand = RendererCommand<CommandAction::Set, Types::Vec4<Types::F32>>;
     using RenderPassCommand = RendererCommand<CommandAction::Set, RenderPass>;
     using BufferInteractCommand = RendererCommand<CommandAction::Set, Buffer>;
     using ShaderInteractCommand = RendererCommand<CommandAction::Set, Shader>;
     using PipelineInteractCommand = RendererCommand<CommandAction::Set, Pipeline>;
+    using DrawCommand = RendererCommand<CommandAction::Set, Mesh>;
 
     using RendererCommandWrapper = std::variant<
         VSyncStateGetCommand,
@@ -121,21 +186,97 @@ namespace Mosaic::Internal::Rendering
         RenderPassCommand,
         BufferInteractCommand,
         ShaderInteractCommand,
-        PipelineInteractCommand>;
+        PipelineInteractCommand,
+        DrawCommand>;
+
+    struct RendererCommandEntry
+    {
+        Types::UI64 Key;
+
+        const RendererCommandWrapper* Command;
+
+        const RendererCommandWrapper* Pipeline = nullptr;
+        const RendererCommandWrapper* Shader = nullptr;
+        const RendererCommandWrapper* Buffer = nullptr;
+    };
+
+    struct RendererCommandStatistics
+    {
+        Types::UI64 SubmittedCommands = 0;
+        Types::UI64 SentCommands = 0;
+        Types::UI64 SubmittedBinds = 0;
+        Types::UI64 EliminatedBinds = 0;
+        Types::UI64 WriterCount = 0;
+    };
+
+    class RendererCommandWriter
+    {
+    public:
+        void Submit(const RendererCommandWrapper& command, Types::UI64 key = 0);
+        void Submit(const RendererCommandWrapper& command, const CommandSortKey& key);
+
+        Types::UI64 GetCommandCount() const;
+
+    private:
+        struct Segment
+        {
+            Types::UI64 Chunk;
+            Types::UI64 First;
+        };
+
+        void BeginChunk(Types::UI64 chunk);
+        void Reset();
+
+        Memory::LinearAllocator mAllocator;
+
+        std::vector<RendererCommandEntry> mEntries;
+        std::vector<Segment> mSegments;
+
+        friend class RendererCommandManager;
+    };
 
     class RendererCommandManager
     {
     public:
         RendererCommandManager(Renderer& renderer);
+        ~RendererCommandManager();
 
-        void Submit(const RendererCommandWrapper& command);
+        void Submit(const RendererCommandWrapper& command, Types::UI64 key = 0);
+        void Submit(const RendererCommandWrapper& command, const CommandSortKey& key);
+
+        void ReserveWriters(Types::UI32 count);
+
+        RendererCommandWriter& GetWriter(Types::UI32 index);
+
+        template <typename Function>
+        inline void Record(Types::UI64 count, Types::UI64 grainSize, Function&& function);
 
-    private:
         void Send();
+
+        void BeginCapture(const std::string& path, Types::UI32 frameCount);
+
+        const RendererCommandStatistics& GetStatistics() const;
+
+    private:
+        void Merge();
+        void Sort();
+        void EliminateRedundantBinds();
         void Purge();
 
-        std::vector<RendererCommandWrapper> mCommands;
+        RendererCommandWriter mWriter;
+
+        std::vector<std::unique_ptr<RendererCommandWriter>> mWriters;
+
+        std::vector<RendererCommandWrapper> mSortedCommands;
+        std::vector<RendererCommandEntry> mEntries;
+        std::vector<RendererCommandEntry> mScratch;
+
+        RendererCommandStatistics mStatistics;
+
+        std::unique_ptr<CommandCapture> mCapture;
 
         Renderer& mRenderer;
     };
-}
\ No newline at end of file
+}
+
+#include "rendering/commands.inl"
\ No newline at end of file
@@ -3,10 +3,106 @@
 #include "rendering/pass.hpp"
 #include "rendering/target.hpp"
 
+#include "utilities/numerics.hpp"
+
+#include <string>
 #include <vector>
 
 namespace Mosaic::Internal::Rendering
 {
+    class RendererCommandManager;
+
+    enum class RenderResourceUsage
+    {
+        ColourAttachment,
+        DepthStencilAttachment,
+        Sampled,
+        Storage,
+        TransferSource,
+        TransferDestination,
+        Present,
+    };
+
+    enum class RenderGraphQueue
+    {
+        Graphics,
+        Compute,
+        Transfer,
+    };
+
+    enum class RenderResourceType
+    {
+        Image,
+        Buffer,
+    };
+
+    struct RenderResourceDescriptor
+    {
+        RenderResourceType Type = RenderResourceType::Image;
+
+        Types::UI32 Width = 0;
+        Types::UI32 Height = 0;
+        Types::UI32 Format = 0;
+
+        Types::UI64 SizeBytes = 0;
+        Types::UI64 Alignment = 256;
+    };
+
+    struct RenderGraphResource
+    {
+        std::string Name;
+
+        RenderResourceDescriptor Descriptor;
+
+        bool Imported;
+        bool Output;
+    };
+
+    struct RenderGraphAccess
+    {
+        Types::UI32 Resource;
+
+        RenderResourceUsage Usage;
+
+        bool Write;
+    };
+
+    struct RenderGraphPass
+    {
+        std::string Name;
+
+        RenderPass* Pass;
+
+        std::vector<RenderGraphAccess> Accesses;
+
+        RenderGraphQueue Queue;
+
+        bool SideEffects;
+    };
+
+    struct RenderResourceLifetime
+    {
+        Types::UI32 FirstPass;
+        Types::UI32 LastPass;
+    };
+
+    struct CompiledRenderGraph
+    {
+        static constexpr Types::UI32 Unused = ~0u;
+        static constexpr Types::UI64 NotAliased = ~0ull;
+
+        std::vector<Types::UI32> Order;
+        std::vector<bool> Culled;
+
+        std::vector<RenderResourceLifetime> Lifetimes;
+        std::vector<Types::UI64> Offsets;
+
+        Types::UI64 TransientBytes = 0;
+        Types::UI64 UnaliasedBytes = 0;
+
+        Types::UI64 Hash = 0;
+    };
+
     class GlobalRenderGraph
     {
     public:
@@ -22,12 +118,45 @@ namespace Mosaic::Internal::Rendering
     class LocalRenderGraph
     {
     public:
-        void AddRenderPass(RenderPass& pass);
+        Types::UI32 AddRenderPass(RenderPass& pass);
+        Types::UI32 AddPass(const std::string& name, RenderPass* pass = nullptr);
+
+        Types::UI32 CreateResource(const std::string& name, const RenderResourceDescriptor& descriptor);
+        Types::UI32 ImportResource(const std::string& name, const RenderResourceDescriptor& descriptor);
+
+        void Read(Types::UI32 pass, Types::UI32 resource, RenderResourceUsage usage);
+        void Write(Types::UI32 pass, Types::UI32 resource, RenderResourceUsage usage);
+
+        void SetMemoryRequirements(Types::UI32 resource, Types::UI64 sizeBytes, Types::UI64 alignment);
+
+        void MarkOutput(Types::UI32 resource);
+        void SetSideEffects(Types::UI32 pass);
+        void SetQueue(Types::UI32 pass, RenderGraphQueue queue);
+
+        const CompiledRenderGraph& Compile();
+
+        void Send(RendererCommandManager& commands);
+        void Reset();
+
+        const std::vector<RenderGraphPass>& GetPasses() const;
+        const std::vector<RenderGraphResource>& GetResources() const;
+
+        bool SharesMemory(Types::UI32 first, Types::UI32 second) const;
 
     private:
-        void Send();
-        void Purge();
+        bool IsValidAccess(Types::UI32 pass, Types::UI32 resource) const;
+
+        Types::UI64 HashTopology() const;
+
+        void SortPasses();
+        void ComputeLifetimes();
+        void AliasResources();
+
+        std::vector<RenderGraphPass> mPasses;
+        std::vector<RenderGraphResource> mResources;
+
+        CompiledRenderGraph mCompiled;
 
-        std::vector<RenderTarget*> mPasses;
+        bool mCompiledValid = false;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "rendering/mesh.hpp"
+
+#include "utilities/json.hpp"
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct ImportedMesh
+    {
+        std::string Name;
+
+        Mesh Data;
+    };
+
+    struct GLTFAccessorView
+    {
+        const std::byte* Data;
+        Types::UI64 Count;
+        Types::UI64 StrideBytes;
+        Types::UI32 ComponentType;
+        Types::UI32 ComponentCount;
+        bool Normalized;
+    };
+
+    class MeshImporter
+    {
+    public:
+        static std::vector<ImportedMesh> Import(const std::string& path);
+
+        static std::vector<ImportedMesh> ImportOBJ(const std::string& path);
+        static std::vector<ImportedMesh> ImportGLTF(const std::string& path);
+
+    private:
+        static constexpr Types::UI64 OBJBlockSize = 1 << 20;
+
+        static bool BuildGLTFPrimitive(const Files::JsonValue& document, const Files::JsonValue& primitive, std::span<const std::span<const std::byte>> buffers, Mesh& mesh);
+
+        static GLTFAccessorView GetGLTFAccessor(const Files::JsonValue& document, Types::UI64 accessor, std::span<const std::span<const std::byte>> buffers);
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <span>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct MeshLOD
+    {
+        Types::UI64 IndexOffset;
+        Types::UI64 IndexCount;
+        Types::F32 Error;
+    };
+
+    struct LODSettings
+    {
+        Types::UI32 LevelCount = 4;
+        Types::F32 TriangleRatio = 0.5f;
+        Types::UI64 MinimumTriangleCount = 64;
+        Types::F32 MaximumError = 0.02f;
+        Types::F32 AttributeWeight = 0.01f;
+        Types::UI32 PositionLocation = 0;
+    };
+
+    class LODSelector
+    {
+    public:
+        LODSelector(Types::F32 pixelErrorThreshold = 1.0f, Types::F32 hysteresis = 0.25f);
+
+        Types::UI32 Select(std::span<const MeshLOD> lods, Types::F32 pixelsPerUnit);
+
+        Types::UI32 GetCurrentLevel() const;
+
+        static Types::F32 ComputePixelsPerUnit(Types::F32 distance, Types::F32 verticalFieldOfView, Types::F32 viewportHeight);
+
+    private:
+        Types::F32 mPixelErrorThreshold;
+        Types::F32 mHysteresis;
+
+        Types::UI32 mCurrentLevel;
+    };
+}
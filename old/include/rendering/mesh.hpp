@@ -1,8 +1,17 @@
 #pragma once
 
+#include "rendering/lod.hpp"
+#include "rendering/meshlets.hpp"
+
+#include "utilities/mappedfile.hpp"
 #include "utilities/numerics.hpp"
 #include "utilities/vector.hpp"
 
+#include <array>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Mosaic::Internal::Rendering
@@ -19,6 +28,13 @@ namespace Mosaic::Internal::Rendering
         UI16,
         UI32,
         UI64,
+        F16,
+        UNorm8,
+        UNorm16,
+        SNorm8,
+        SNorm16,
+        UNorm1010102,
+        SNorm1010102,
     };
 
     template <TypeConcepts::Numeric T>
@@ -86,6 +102,48 @@ namespace Mosaic::Internal::Rendering
         static constexpr VertexAttributeType Value = VertexAttributeType::UI64;
     };
 
+    template <>
+    struct VertexAttributeTypeMapping<Types::F16>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::F16;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::UNorm8>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::UNorm8;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::UNorm16>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::UNorm16;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::SNorm8>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::SNorm8;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::SNorm16>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::SNorm16;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::UNorm1010102>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::UNorm1010102;
+    };
+
+    template <>
+    struct VertexAttributeTypeMapping<Types::SNorm1010102>
+    {
+        static constexpr VertexAttributeType Value = VertexAttributeType::SNorm1010102;
+    };
+
     template <typename T>
     struct AttributeInfo
     {
@@ -104,19 +162,61 @@ namespace Mosaic::Internal::Rendering
         using Type = T;
     };
 
+    enum class VertexLayout
+    {
+        Interleaved,
+        Deinterleaved,
+    };
+
+    struct VertexAttributeDescriptor
+    {
+        VertexAttributeType Type;
+        Types::UI32 ComponentCount;
+        Types::UI32 Location;
+        Types::UI32 Stream;
+        Types::UI32 OffsetBytes;
+    };
+
+    struct VertexStreamDescriptor
+    {
+        Types::UI32 Binding;
+        Types::UI32 StrideBytes;
+    };
+
+    struct VertexLayoutDescriptor
+    {
+        VertexLayout Layout;
+
+        std::vector<VertexStreamDescriptor> Streams;
+        std::vector<VertexAttributeDescriptor> Attributes;
+    };
+
     class VertexAttributeBase
     {
     protected:
+        static constexpr Types::UI32 AutomaticStream = ~0u;
+
         VertexAttributeType EnumType;
         Types::UI32 LengthBytes;
         Types::UI32 OffsetBytes;
         Types::UI32 Index;
         Types::UI32 TypeSize;
         Types::UI32 Count;
+        Types::UI32 RequestedStream = AutomaticStream;
+        Types::UI32 Stream = 0;
 
         friend class Mesh;
+        friend class MeshFile;
+        friend class MeshImporter;
+        friend class VertexFormat;
     };
 
+    namespace Detail
+    {
+        template <Types::UI64 N>
+        constexpr std::array<Types::UI32, N> ExclusivePrefixSum(const std::array<Types::UI32, N>& values);
+    }
+
     template <typename T>
     class VertexAttribute : public VertexAttributeBase
     {
@@ -131,57 +231,272 @@ namespace Mosaic::Internal::Rendering
     class VertexFormat
     {
     public:
+        VertexFormat& SetLayout(VertexLayout layout);
+
         template <typename T>
         VertexFormat& AddAttribute(VertexAttribute<T>&& attribute);
 
+        template <typename T>
+        VertexFormat& AddAttribute(VertexAttribute<T>&& attribute, Types::UI32 stream);
+
         template <typename T>
         void AddAttribute(const VertexAttribute<T>& attribute) = delete;
 
+        const VertexLayoutDescriptor& GetLayoutDescriptor() const;
+
     private:
+        void ResolveLayout();
+
         std::vector<VertexAttributeBase> mAttributes;
 
+        VertexLayout mLayout = VertexLayout::Interleaved;
+        VertexLayoutDescriptor mLayoutDescriptor;
+
         friend class Mesh;
+        friend class MeshFile;
+        friend class MeshImporter;
+    };
+
+    template <typename T>
+    struct StaticAttributeInfo
+    {
+    };
+
+    template <typename T>
+    struct StaticAttributeInfo<VertexAttribute<T>>
+    {
+        static constexpr VertexAttributeType EnumType = AttributeInfo<T>::EnumType;
+        static constexpr Types::UI32 LengthBytes = AttributeInfo<T>::Count * AttributeInfo<T>::TypeSize;
+        using Type = T;
+    };
+
+    template <typename... Attributes>
+    class StaticVertexFormat : public VertexFormat
+    {
+    public:
+        static_assert(sizeof...(Attributes) > 0, "Static vertex formats require at least one attribute");
+
+        static constexpr Types::UI32 AttributeCount = sizeof...(Attributes);
+        static constexpr Types::UI32 StrideBytes = (StaticAttributeInfo<Attributes>::LengthBytes + ...);
+
+        static constexpr std::array<VertexAttributeType, AttributeCount> AttributeTypes = {StaticAttributeInfo<Attributes>::EnumType...};
+        static constexpr std::array<Types::UI32, AttributeCount> AttributeLengths = {StaticAttributeInfo<Attributes>::LengthBytes...};
+        static constexpr std::array<Types::UI32, AttributeCount> AttributeOffsets = Detail::ExclusivePrefixSum(AttributeLengths);
+
+        StaticVertexFormat();
+
+        VertexFormat& SetLayout(VertexLayout layout) = delete;
+
+        template <typename T>
+        VertexFormat& AddAttribute(VertexAttribute<T>&& attribute) = delete;
+
+        template <typename T>
+        VertexFormat& AddAttribute(VertexAttribute<T>&& attribute, Types::UI32 stream) = delete;
+    };
+
+    enum class IndexType
+    {
+        UI16,
+        UI32,
+    };
+
+    enum class MeshUsage
+    {
+        Static,
+        Dynamic,
+    };
+
+    struct MeshDirtyRange
+    {
+        Types::UI64 First;
+        Types::UI64 Count;
+    };
+
+    struct MeshOptimisationSettings
+    {
+        bool Weld = true;
+        bool OptimiseVertexCache = true;
+        bool OptimiseOverdraw = true;
+        bool OptimiseVertexFetch = true;
+
+        Types::UI32 CacheSize = 16;
+        Types::UI32 PositionLocation = 0;
     };
 
     class Buffer
     {
     };
 
+    class MeshIdentity
+    {
+    public:
+        MeshIdentity();
+        MeshIdentity(const MeshIdentity& other) noexcept;
+        ~MeshIdentity();
+
+        MeshIdentity& operator=(const MeshIdentity& other) noexcept;
+
+        Types::UI64 GetID() const;
+
+        static Types::UI64 NextGeneration();
+
+        static void Release(Types::UI64 id);
+        static std::vector<Types::UI64> TakeReleased();
+
+    private:
+        struct Registry;
+
+        static Registry& GetRegistry();
+
+        Types::UI64 mID;
+    };
+
     class Mesh
     {
     public:
         Mesh();
 
+        Mesh(const Mesh& other);
+        Mesh(Mesh&& other) noexcept = default;
+
+        Mesh& operator=(const Mesh& other);
+        Mesh& operator=(Mesh&& other) noexcept = default;
+
         void SetVertexFormat(VertexFormat& format);
+        void SetVertexFormat(std::shared_ptr<VertexFormat> format);
 
         template <typename... Args>
         inline void SetVertexData(const std::vector<Args>&... data);
 
+        template <typename... Attributes, typename... Args>
+        inline void SetVertexData(StaticVertexFormat<Attributes...>& format, const std::vector<Args>&... data);
+
+        void SetUsage(MeshUsage usage);
+
+        template <typename... Args>
+        inline void UpdateRange(Types::UI64 first, Types::UI64 count, const std::vector<Args>&... data);
+
+        void SetIndexData(std::span<const Types::UI32> indices);
+        void UpdateIndexRange(Types::UI64 first, std::span<const Types::UI32> indices);
+
+        void Optimise(const MeshOptimisationSettings& settings = {});
+
+        void GenerateLODs(const LODSettings& settings = {});
+
+        static void GenerateLODs(std::span<Mesh* const> meshes, const LODSettings& settings = {});
+
+        void GenerateMeshlets(const MeshletSettings& settings = {});
+
         void Submit();
         void Unsubmit();
 
+        Types::UI64 GetID() const;
+        Types::UI64 GetGeneration() const;
+
+        static std::vector<Types::UI64> TakeReleasedMeshes();
+
+        MeshUsage GetUsage() const;
+
+        std::span<const MeshDirtyRange> GetDirtyVertexRanges() const;
+        std::span<const MeshDirtyRange> GetDirtyIndexRanges() const;
+
+        void ClearDirtyRanges();
+
+        IndexType GetIndexType() const;
+        Types::UI64 GetIndexCount() const;
+        std::span<const std::byte> GetIndexData() const;
+
+        std::span<const MeshLOD> GetLODs() const;
+
+        const MeshletView& GetMeshlets() const;
+
+        bool IsMapped() const;
+
+        const VertexLayoutDescriptor& GetLayoutDescriptor() const;
+
+        Types::UI32 GetStreamCount() const;
+        std::span<const std::byte> GetStreamData(Types::UI32 stream) const;
+        std::span<const std::byte> GetAttributeStreamData(Types::UI32 location) const;
+
+        Types::UI64 GetVertexCount() const;
+
     private:
         bool CanSetVertexData() const;
+        bool CanModify() const;
+        bool CanUpdateRange() const;
+
+        void RefreshViews();
 
         template <Types::UI64 NumInputs>
         bool ValidateAttributeCount() const;
 
         template <typename... Args>
-        bool ValidateAttributeData(const std::vector<Args>&... data, std::array<Types::UI32, sizeof...(Args)>& outCounts);
+        bool ValidateAttributeData(const std::vector<Args>&... data, std::array<Types::UI64, sizeof...(Args)>& outCounts);
 
         template <Types::UI64 NumInputs>
-        bool ValidateVertexCounts(const std::array<Types::UI32, NumInputs>& counts);
+        bool ValidateVertexCounts(const std::array<Types::UI64, NumInputs>& counts);
+
+        void AllocateStreams(Types::UI64 vertexCount);
+
+        template <typename Interleave>
+        void WriteVertexData(Types::UI64 vertexCount, Interleave&& interleave);
 
         template <Types::UI64... NumInputs, typename... Args>
-        void InterleaveVertexData(Types::UI32 vertex, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple);
+        void InterleaveVertexData(Types::UI64 first, Types::UI64 last, Types::UI64 destinationFirst, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple);
+
+        template <typename Format, Types::UI64... NumInputs, typename... Args>
+        void InterleaveStaticVertexData(Types::UI64 first, Types::UI64 last, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple);
+
+        void DiscardDerivedData();
+        void RevalidateIndices();
+
+        void PackIndices(std::span<const Types::UI32> indices);
+        void AppendIndices(std::span<const Types::UI32> indices);
+        std::vector<Types::UI32> UnpackIndices() const;
+
+        void WeldVertices(std::vector<Types::UI32>& indices);
+        void RemapVertexStreams(std::span<const Types::UI32> remap, Types::UI64 newVertexCount);
+
+        const std::byte* GetPositionData(Types::UI32 location) const;
+
+        static void MarkDirty(std::vector<MeshDirtyRange>& ranges, Types::UI64 first, Types::UI64 count);
+
+        static constexpr Types::UI64 ParallelInterleaveThreshold = 1 << 16;
+        static constexpr Types::UI64 DirtyRangeMergeGap = 64;
+        static constexpr Types::UI32 MaximumShortIndex = 0xFFFE;
 
         VertexFormat* mFormat;
 
-        std::vector<std::byte> mRawData;
+        std::vector<std::vector<std::byte>> mStreams;
+        std::vector<std::byte> mIndexData;
+        std::vector<MeshLOD> mLODs;
+
+        MeshletData mMeshlets;
+
+        std::vector<std::span<const std::byte>> mStreamViews;
+        std::span<const std::byte> mIndexView;
+        std::span<const MeshLOD> mLODView;
+        MeshletView mMeshletView;
+
+        std::shared_ptr<const Files::MappedFile> mMapping;
+        std::shared_ptr<VertexFormat> mOwnedFormat;
 
-        Types::UI32 mVertexLengthBytes;
+        Types::UI64 mVertexCount;
+        Types::UI64 mIndexCount;
+
+        IndexType mIndexType;
+        MeshUsage mUsage;
+
+        std::vector<MeshDirtyRange> mDirtyVertexRanges;
+        std::vector<MeshDirtyRange> mDirtyIndexRanges;
+
+        MeshIdentity mIdentity;
+        Types::UI64 mGeneration;
 
         bool mSubmitted;
+
+        friend class MeshFile;
+        friend class MeshImporter;
     };
 }
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Mosaic::Internal::Files
+{
+    class MappedFile;
+}
+
+namespace Mosaic::Internal::Rendering
+{
+    class Mesh;
+    class VertexFormat;
+
+    struct MeshletView;
+
+    struct MeshFileSection
+    {
+        Types::UI64 Offset;
+        Types::UI64 Size;
+    };
+
+    struct MeshFileAttribute
+    {
+        Types::UI32 Type;
+        Types::UI32 LengthBytes;
+        Types::UI32 TypeSize;
+        Types::UI32 Count;
+        Types::UI32 Stream;
+        Types::UI32 Reserved;
+    };
+
+    struct MeshFileHeader
+    {
+        std::array<char, 4> Magic;
+        Types::UI32 Version;
+
+        Types::UI64 FileSize;
+        Types::UI64 ContentHash;
+
+        Types::UI32 Layout;
+        Types::UI32 IndexType;
+
+        Types::UI64 VertexCount;
+        Types::UI64 IndexCount;
+
+        Types::UI32 AttributeCount;
+        Types::UI32 StreamCount;
+        Types::UI32 LODCount;
+        Types::UI32 MeshletCount;
+
+        MeshFileSection Attributes;
+        MeshFileSection Streams;
+        MeshFileSection Indices;
+        MeshFileSection LODs;
+        MeshFileSection Meshlets;
+        MeshFileSection MeshletVertices;
+        MeshFileSection MeshletTriangles;
+        MeshFileSection BoundingSpheres;
+        MeshFileSection NormalCones;
+    };
+
+    class MeshFile
+    {
+    public:
+        static constexpr std::array<char, 4> Magic = {'M', 'M', 'S', 'H'};
+        static constexpr Types::UI32 Version = 1;
+        static constexpr Types::UI64 SectionAlignment = 64;
+
+        static Types::UI64 Write(const Mesh& mesh, const std::string& path);
+        static Types::UI64 Load(const std::string& path, Mesh& mesh);
+
+        static std::vector<std::byte> Serialise(const Mesh& mesh, const std::string& path);
+        static Types::UI64 Load(std::shared_ptr<const Files::MappedFile> mapping, std::span<const std::byte> file, Mesh& mesh, const std::string& path);
+
+        static std::vector<MeshFileAttribute> SerialiseFormat(const VertexFormat& format);
+        static std::shared_ptr<VertexFormat> LoadFormat(Types::UI32 layout, std::span<const MeshFileAttribute> attributes, const std::string& path);
+
+        static MeshFileSection AppendSection(std::vector<std::byte>& buffer, const void* data, Types::UI64 size);
+
+        template <typename T>
+        static std::span<const T> GetSection(std::span<const std::byte> file, const MeshFileSection& section);
+
+        static void ValidateIndices(std::span<const std::byte> indices, Types::UI64 indexSize, Types::UI64 vertexCount, const std::string& path);
+        static void ValidateMeshlets(const MeshletView& meshlets, Types::UI64 vertexCount, const std::string& path);
+    };
+}
+
+#include "rendering/meshfile.inl"
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "rendering/optimiser.hpp"
+
+#include "utilities/numerics.hpp"
+#include "utilities/vector.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct Meshlet
+    {
+        Types::UI32 VertexOffset;
+        Types::UI32 TriangleOffset;
+        Types::UI32 VertexCount;
+        Types::UI32 TriangleCount;
+    };
+
+    struct MeshletSettings
+    {
+        Types::UI32 MaximumVertices = 64;
+        Types::UI32 MaximumTriangles = 124;
+        Types::UI32 PositionLocation = 0;
+    };
+
+    struct MeshletView
+    {
+        std::span<const Meshlet> Meshlets;
+
+        std::span<const Types::UI32> Vertices;
+        std::span<const Types::UI8> Triangles;
+
+        std::span<const Types::Vec4<Types::F32>> BoundingSpheres;
+        std::span<const Types::Vec4<Types::F32>> NormalCones;
+    };
+
+    struct MeshletData
+    {
+        std::vector<Meshlet> Meshlets;
+
+        std::vector<Types::UI32> Vertices;
+        std::vector<Types::UI8> Triangles;
+
+        std::vector<Types::Vec4<Types::F32>> BoundingSpheres;
+        std::vector<Types::Vec4<Types::F32>> NormalCones;
+
+        MeshletView GetView() const;
+    };
+
+    struct MeshletCullStatistics
+    {
+        Types::UI64 MeshletsTested = 0;
+        Types::UI64 MeshletsVisible = 0;
+        Types::UI64 FrustumRejected = 0;
+        Types::UI64 ConeRejected = 0;
+
+        Types::UI64 TrianglesTested = 0;
+        Types::UI64 TrianglesVisible = 0;
+    };
+
+    namespace Meshlets
+    {
+        void Build(std::span<const Types::UI32> indices, const VertexStreamView& positions, Types::UI64 vertexCount, const MeshletSettings& settings, MeshletData& outData);
+
+        MeshletCullStatistics Cull(const MeshletView& data, const std::array<Types::Vec4<Types::F32>, 6>& frustumPlanes, const Types::Vec3<Types::F32>& cameraPosition, std::vector<Types::UI32>& outVisible);
+    }
+}
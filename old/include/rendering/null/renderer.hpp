@@ -0,0 +1,54 @@
+#pragma once
+
+#include "rendering/renderer.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct NullRendererStatistics
+    {
+        Types::UI64 Frames = 0;
+        Types::UI64 Commands = 0;
+        Types::UI64 Draws = 0;
+        Types::UI64 Instances = 0;
+        Types::UI64 RenderPasses = 0;
+        Types::UI64 StateChanges = 0;
+        Types::UI64 BytesUploaded = 0;
+        Types::UI64 ValidationErrors = 0;
+    };
+
+    class NullRenderer : public RendererInterface
+    {
+    public:
+        NullRenderer(Renderer& renderer);
+
+        const NullRendererStatistics& GetFrameStatistics() const;
+        const NullRendererStatistics& GetTotalStatistics() const;
+
+    private:
+        void Create() override;
+        void Update() override;
+        void LoadConfig() override;
+
+        void Execute(const RendererPacketCommand& command);
+        void Upload(const RendererMeshUpload& upload);
+        void Report() const;
+
+        void Invalid(const std::string& message);
+
+        NullRendererStatistics mFrameStatistics;
+        NullRendererStatistics mTotalStatistics;
+
+        std::unordered_set<Types::UI64> mResidentMeshes;
+
+        std::optional<Types::UI64> mBoundPipeline;
+
+        Types::UI64 mReportInterval;
+        Renderer& mRenderer;
+    };
+}
@@ -3,14 +3,10 @@
 #include "rendering/renderer.hpp"
 
 #include "utilities/numerics.hpp"
+#include "utilities/vector.hpp"
 
 #include <SDL3/SDL_video.h>
 
-namespace Mosaic::Internal::Windowing
-{
-    struct WindowResizeEvent;
-}
-
 namespace Mosaic::Internal::Rendering
 {
     class OpenGLRenderer : public RendererInterface
@@ -23,10 +19,10 @@ namespace Mosaic::Internal::Rendering
         void Update() override;
         void LoadConfig() override;
 
-        void OnResize(const Windowing::WindowResizeEvent& event);
-
         SDL_GLContext mContext;
 
+        Types::Vec2<Types::UI32> mViewportSize;
+
         Types::UI32 mSwapInterval;
         Renderer& mRenderer;
     };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "rendering/mesh.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    class OpenGLVertexArray
+    {
+    public:
+        OpenGLVertexArray();
+
+        void Create(const VertexLayoutDescriptor& layout);
+        void Destroy();
+
+        void BindStreams(std::span<const Types::UI32> buffers);
+        void Bind() const;
+
+        Types::UI32 Get() const;
+
+    private:
+        Types::UI32 mHandle;
+
+        std::vector<VertexStreamDescriptor> mStreams;
+    };
+}
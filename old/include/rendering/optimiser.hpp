@@ -0,0 +1,34 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct VertexStreamView
+    {
+        const std::byte* Data;
+        Types::UI64 StrideBytes;
+    };
+
+    namespace Optimiser
+    {
+        inline constexpr Types::UI32 UnusedVertex = ~0u;
+
+        Types::UI64 GenerateWeldRemap(std::span<const VertexStreamView> streams, Types::UI64 vertexCount, std::vector<Types::UI32>& outRemap);
+
+        void OptimiseVertexCache(std::span<Types::UI32> indices, Types::UI64 vertexCount, Types::UI32 cacheSize);
+
+        void OptimiseOverdraw(std::span<Types::UI32> indices, const VertexStreamView& positions, Types::UI64 vertexCount, Types::UI32 cacheSize);
+
+        Types::UI64 GenerateVertexFetchRemap(std::span<const Types::UI32> indices, Types::UI64 vertexCount, std::vector<Types::UI32>& outRemap);
+
+        void RemapIndices(std::span<Types::UI32> indices, std::span<const Types::UI32> remap);
+        void RemapVertices(std::span<const std::byte> source, std::span<std::byte> destination, Types::UI64 strideBytes, std::span<const Types::UI32> remap);
+
+        Types::F32 ComputeACMR(std::span<const Types::UI32> indices, Types::UI64 vertexCount, Types::UI32 cacheSize);
+    }
+}
@@ -1,13 +1,140 @@
 #pragma once
 
+#include "utilities/numerics.hpp"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace Mosaic::Internal::Rendering
 {
+    class VertexFormat;
+
+    enum class ShaderStage
+    {
+        Vertex,
+        Fragment,
+        Compute,
+    };
+
     class Shader
     {
+    public:
+        Shader() = default;
+        Shader(ShaderStage stage, std::vector<Types::UI32> code, const std::string& entryPoint = "main");
+
+        ShaderStage GetStage() const;
+        std::span<const Types::UI32> GetCode() const;
+        const std::string& GetEntryPoint() const;
+
+        Types::UI64 GetHash() const;
+
+    private:
+        ShaderStage mStage = ShaderStage::Vertex;
+
+        std::vector<Types::UI32> mCode;
+        std::string mEntryPoint = "main";
+
+        Types::UI64 mHash = 0;
+    };
+
+    enum class PrimitiveTopology
+    {
+        Points,
+        Lines,
+        LineStrip,
+        Triangles,
+        TriangleStrip,
+    };
+
+    enum class CullMode
+    {
+        None,
+        Front,
+        Back,
+    };
+
+    enum class BlendMode
+    {
+        Opaque,
+        Alpha,
+        Premultiplied,
+        Additive,
+    };
+
+    enum class CompareOperation
+    {
+        Never,
+        Less,
+        Equal,
+        LessEqual,
+        Greater,
+        NotEqual,
+        GreaterEqual,
+        Always,
+    };
+
+    struct DepthStateDescriptor
+    {
+        bool Test = true;
+        bool Write = true;
+
+        CompareOperation Compare = CompareOperation::Less;
+    };
+
+    struct PipelineDescriptor
+    {
+        std::vector<const Shader*> Shaders;
+
+        const VertexFormat* Format = nullptr;
+
+        PrimitiveTopology Topology = PrimitiveTopology::Triangles;
+        CullMode Cull = CullMode::Back;
+        BlendMode Blend = BlendMode::Opaque;
+
+        DepthStateDescriptor Depth;
+
+        std::vector<Types::UI32> ColourFormats;
+        Types::UI32 DepthFormat = 0;
+        Types::UI32 SampleCount = 1;
+    };
+
+    struct PipelineSnapshot
+    {
+        PipelineSnapshot(const PipelineDescriptor& descriptor);
+
+        PipelineDescriptor Descriptor;
+
+        Types::UI64 Hash;
+
+        std::vector<std::shared_ptr<const Shader>> Shaders;
+        std::shared_ptr<const VertexFormat> Format;
     };
 
     class Pipeline
     {
+    public:
+        Pipeline() = default;
+        Pipeline(const PipelineDescriptor& descriptor);
+
+        const PipelineDescriptor& GetDescriptor() const;
+
+        Types::UI64 GetHash() const;
+
+        bool IsValid() const;
+
+        static Types::UI64 Hash(const PipelineDescriptor& descriptor);
+
+    private:
+        PipelineDescriptor mDescriptor;
+
+        Types::UI64 mHash = 0;
     };
 
     class ShaderDescriptor
@@ -19,12 +146,82 @@ namespace Mosaic::Internal::Rendering
         Shader& mShader;
     };
 
-    class PipelineDescriptor
+    enum class PipelineMissPolicy
+    {
+        Skip,
+        Fallback,
+    };
+
+    enum class PipelineCompileState
+    {
+        Missing,
+        Compiling,
+        Ready,
+        Failed,
+    };
+
+    struct PipelineCacheStatistics
+    {
+        Types::UI64 Hits = 0;
+        Types::UI64 Misses = 0;
+        Types::UI64 Fallbacks = 0;
+        Types::UI64 Skips = 0;
+        Types::UI64 Compiled = 0;
+        Types::UI64 Failed = 0;
+    };
+
+    template <typename T>
+    class PipelineStateCache
     {
     public:
-        PipelineDescriptor(Pipeline& pipeline);
+        using Compiler = std::function<T(const PipelineDescriptor&)>;
+
+        PipelineStateCache() = default;
+        ~PipelineStateCache();
+
+        PipelineStateCache(const PipelineStateCache&) = delete;
+        PipelineStateCache& operator=(const PipelineStateCache&) = delete;
+
+        void SetCompiler(Compiler compiler);
+        void SetMissPolicy(PipelineMissPolicy policy);
+        void SetFallback(const Pipeline& pipeline);
+
+        const T* Acquire(const std::shared_ptr<const PipelineSnapshot>& pipeline);
+
+        void Prewarm(std::span<const Pipeline> pipelines);
+        void WaitIdle();
+
+        void Reset();
+
+        PipelineCompileState GetState(const Pipeline& pipeline) const;
+        PipelineCacheStatistics GetStatistics() const;
 
     private:
-        Pipeline& mPipeline;
+        struct Entry
+        {
+            PipelineCompileState State = PipelineCompileState::Missing;
+
+            T Object;
+
+            std::shared_future<void> Compiled;
+        };
+
+        void Compile(std::shared_ptr<const PipelineSnapshot> pipeline, Entry& entry);
+        void Store(Types::UI64 hash, std::optional<T>&& object);
+
+        const T* Find(Types::UI64 hash) const;
+
+        Compiler mCompiler;
+
+        PipelineMissPolicy mMissPolicy = PipelineMissPolicy::Skip;
+        Types::UI64 mFallback = 0;
+
+        std::unordered_map<Types::UI64, Entry> mEntries;
+
+        PipelineCacheStatistics mStatistics;
+
+        mutable std::mutex mMutex;
     };
-}
\ No newline at end of file
+}
+
+#include "rendering/pipeline.inl"
\ No newline at end of file
@@ -3,9 +3,20 @@
 #include "rendering/commands.hpp"
 
 #include "utilities/numerics.hpp"
+#include "utilities/threading.hpp"
 #include "utilities/vector.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace Mosaic::Internal
 {
@@ -20,7 +31,7 @@ namespace Mosaic::Internal::Windowing
 
 namespace Mosaic::Internal::Rendering
 {
-    enum class RendererVSync
+    enum class RendererVSync : Types::I32
     {
         Disabled,
         Strict,
@@ -31,14 +42,86 @@ namespace Mosaic::Internal::Rendering
     {
         Vulkan,
         OpenGL,
+        Null,
+    };
+
+    struct RendererMeshWrite
+    {
+        Types::UI32 Stream;
+        Types::UI64 OffsetBytes;
+
+        std::vector<std::byte> Data;
+    };
+
+    struct RendererMeshUpload
+    {
+        static constexpr Types::UI32 IndexStream = ~0u;
+
+        Types::UI64 Mesh;
+        Types::UI64 Generation;
+        Types::UI64 VertexCount;
+
+        std::vector<Types::UI64> StreamBytes;
+        Types::UI64 IndexBytes;
+
+        std::vector<RendererMeshWrite> Writes;
+    };
+
+    struct RendererPassBegin
+    {
+    };
+
+    struct RendererPipelineBind
+    {
+        std::shared_ptr<const PipelineSnapshot> Pipeline;
+    };
+
+    struct RendererShaderBind
+    {
+        Types::UI64 Shader;
+    };
+
+    struct RendererBufferBind
+    {
+    };
+
+    struct RendererDraw
+    {
+        Types::UI64 Mesh;
+        Types::UI32 InstanceCount;
+    };
+
+    using RendererPacketCommand = std::variant<
+        VSyncStateSetCommand,
+        SwapColourSetCommand,
+        RendererPassBegin,
+        RendererBufferBind,
+        RendererShaderBind,
+        RendererPipelineBind,
+        RendererDraw>;
+
+    struct RendererFramePacket
+    {
+        std::vector<RendererPacketCommand> Commands;
+        std::vector<RendererMeshUpload> MeshUploads;
+        std::vector<std::byte> FrameData;
+        std::vector<Types::UI64> ReleasedMeshes;
+
+        Types::Vec4<Types::F32> ClearColour;
+        Types::Vec2<Types::UI32> WindowSize;
+
+        Types::UI64 FrameIndex = 0;
     };
 
     class RendererInterface
     {
     protected:
+        virtual ~RendererInterface() = default;
+
         virtual void LoadConfig() = 0;
         virtual void Create() = 0;
         virtual void Update() = 0;
+        virtual void PrewarmPipelines(std::span<const Pipeline> pipelines);
 
         friend class Renderer;
     };
@@ -47,17 +130,60 @@ namespace Mosaic::Internal::Rendering
     {
     public:
         Renderer(Windowing::Window& window, EventManager& eventManager);
+        ~Renderer();
+
+        Renderer(const Renderer&) = delete;
+        Renderer& operator=(const Renderer&) = delete;
 
         void SetConfigPath(const std::string& path);
+        void SetFrameData(std::span<const std::byte> data);
+
+        void PrewarmPipelines(std::span<const Pipeline> pipelines);
+
+        void SetBackendTiming(bool enabled);
+        std::vector<Types::F64> TakeBackendTimes();
 
     protected:
         void LoadConfig();
         void Create();
         void Update();
-        virtual void ManageCommands() = 0;
+        void Stop();
+        void UpdateCommands(std::span<const RendererCommandWrapper> commands);
+
+        void WritePacket(RendererFramePacket& packet);
+        void WriteMeshUpload(Mesh& mesh, RendererFramePacket& packet);
+
+        std::shared_ptr<const PipelineSnapshot> SnapshotPipeline(const Pipeline& pipeline);
+        void RenderLoop(std::stop_token stop);
+        void UpdateBackend();
+
+        static constexpr Types::UI32 FramePacketCount = 3;
 
         std::string mConfigPath;
 
+        std::vector<RendererCommandWrapper> mCommands;
+        std::vector<std::byte> mFrameData;
+
+        std::unordered_map<Types::UI64, Types::UI64> mUploadedMeshes;
+        std::unordered_map<Types::UI64, std::shared_ptr<const PipelineSnapshot>> mPipelineSnapshots;
+
+        RendererFramePacket mImmediateFrame;
+        const RendererFramePacket* mFrame;
+
+        Threading::BufferedExchange<RendererFramePacket, FramePacketCount> mFrames;
+
+        std::vector<Types::F64> mBackendTimes;
+        std::mutex mBackendTimesMutex;
+        std::atomic<bool> mBackendTiming;
+
+        std::exception_ptr mRenderError;
+        std::mutex mRenderErrorMutex;
+        std::jthread mRenderThread;
+
+        Types::UI64 mFrameIndex;
+
+        bool mThreaded;
+
         Types::Vec4<Types::F32> mClearColour;
 
         RendererAPI mAPI;
@@ -69,7 +195,9 @@ namespace Mosaic::Internal::Rendering
 
         friend class Mosaic::Internal::Application;
         friend class Mosaic::Internal::Windowing::Window;
+        friend class RendererCommandManager;
         friend class OpenGLRenderer;
         friend class VulkanRenderer;
+        friend class NullRenderer;
     };
 }
\ No newline at end of file
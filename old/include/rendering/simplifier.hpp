@@ -0,0 +1,32 @@
+#pragma once
+
+#include "rendering/optimiser.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct SimplifierAttributeView
+    {
+        const std::byte* Data;
+        Types::UI64 StrideBytes;
+        Types::UI32 ComponentCount;
+    };
+
+    struct SimplifierSettings
+    {
+        Types::UI64 TargetIndexCount;
+        Types::F32 MaximumError;
+        Types::F32 AttributeWeight;
+    };
+
+    namespace Simplifier
+    {
+        Types::F32 Simplify(std::span<const Types::UI32> indices, const VertexStreamView& positions, std::span<const SimplifierAttributeView> attributes, Types::UI64 vertexCount, const SimplifierSettings& settings, std::vector<Types::UI32>& outIndices);
+
+        Types::F32 ComputeExtent(std::span<const Types::UI32> indices, const VertexStreamView& positions);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "rendering/graph.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct VulkanResourceState
+    {
+        vk::PipelineStageFlags2 Stages;
+        vk::AccessFlags2 Access;
+        vk::ImageLayout Layout;
+    };
+
+    struct VulkanPassQueue
+    {
+        Types::UI32 Family;
+
+        vk::PipelineStageFlags2 Stages;
+    };
+
+    struct VulkanPlannedBarrier
+    {
+        Types::UI32 Resource;
+
+        VulkanResourceState Source;
+        VulkanResourceState Destination;
+
+        Types::UI32 SourceFamily = VK_QUEUE_FAMILY_IGNORED;
+        Types::UI32 DestinationFamily = VK_QUEUE_FAMILY_IGNORED;
+    };
+
+    struct VulkanBarrierStatistics
+    {
+        Types::UI32 Barriers = 0;
+        Types::UI32 Batches = 0;
+        Types::UI32 LayoutTransitions = 0;
+        Types::UI32 ElidedBarriers = 0;
+        Types::UI32 OwnershipTransfers = 0;
+    };
+
+    class VulkanBarrierPlanner
+    {
+    public:
+        static VulkanResourceState GetState(RenderResourceUsage usage, bool write);
+
+        void SetInitialState(Types::UI32 resource, const VulkanResourceState& state);
+        void SetFinalState(Types::UI32 resource, const VulkanResourceState& state);
+
+        void Plan(const LocalRenderGraph& graph, const CompiledRenderGraph& compiled, std::span<const VulkanPassQueue> queues = {});
+
+        void RecordPass(vk::CommandBuffer commandBuffer, Types::UI32 position, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const;
+        void RecordRelease(vk::CommandBuffer commandBuffer, Types::UI32 position, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const;
+        void RecordFinal(vk::CommandBuffer commandBuffer, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const;
+
+        const std::vector<VulkanPlannedBarrier>& GetPassBarriers(Types::UI32 position) const;
+        const std::vector<VulkanPlannedBarrier>& GetFinalBarriers() const;
+
+        const VulkanBarrierStatistics& GetStatistics() const;
+
+    private:
+        struct TrackedState
+        {
+            VulkanResourceState Writer;
+            VulkanResourceState Readers;
+
+            vk::ImageLayout Layout;
+
+            Types::UI32 Family = VK_QUEUE_FAMILY_IGNORED;
+            Types::UI32 LastPosition = 0;
+        };
+
+        static vk::ImageAspectFlags GetAspect(const RenderResourceDescriptor& descriptor);
+
+        bool Transition(TrackedState& tracked, const VulkanResourceState& destination, bool write, bool buffer, VulkanResourceState& source);
+
+        void Record(vk::CommandBuffer commandBuffer, const std::vector<VulkanPlannedBarrier>& barriers, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const;
+
+        std::vector<std::optional<VulkanResourceState>> mInitialStates;
+        std::vector<std::optional<VulkanResourceState>> mFinalStates;
+
+        std::vector<std::vector<VulkanPlannedBarrier>> mPassBarriers;
+        std::vector<std::vector<VulkanPlannedBarrier>> mReleaseBarriers;
+        std::vector<VulkanPlannedBarrier> mFinalBarriers;
+
+        std::vector<vk::ImageAspectFlags> mAspects;
+        std::vector<bool> mBuffers;
+
+        VulkanBarrierStatistics mStatistics;
+    };
+}
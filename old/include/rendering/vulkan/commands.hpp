@@ -3,6 +3,11 @@
 #include "utilities/numerics.hpp"
 #include "utilities/vector.hpp"
 
+#include <array>
+#include <functional>
+#include <span>
+#include <vector>
+
 #include <vulkan/vulkan.hpp>
 
 namespace Mosaic::Internal::Rendering
@@ -12,33 +17,52 @@ namespace Mosaic::Internal::Rendering
     class VulkanSwapchain;
     class VulkanRenderPass;
     class VulkanFramebuffer;
+    class VulkanBarrierPlanner;
+    class VulkanQueueScheduler;
+
+    struct VulkanCommandFrame
+    {
+        std::vector<std::array<vk::UniqueCommandPool, 3>> Pools;
+        std::vector<vk::CommandBuffer> CommandBuffers;
+
+        std::vector<std::vector<vk::CommandBuffer>> Secondaries;
+        std::vector<Types::UI32> SecondaryCounts;
+    };
 
-    struct VulkanFrameSubmitDescriptor
+    struct VulkanDrawList
     {
-        vk::CommandBuffer Command;
-        vk::Semaphore WaitSemaphore;
-        vk::Semaphore SignalSemaphore;
-        vk::Fence InFlightFence;
-        vk::PipelineStageFlags WaitStage;
+        Types::UI64 Count = 0;
+        Types::UI64 GrainSize = 64;
+
+        std::function<void(vk::CommandBuffer, Types::UI64, Types::UI64)> Record;
     };
 
     class VulkanCommandSystem
     {
     public:
-        void Create(VulkanDevice& device, VulkanQueues& queues);
-        void AllocateCommandBuffers(VulkanDevice& device, VulkanSwapchain& swapchain);
-        void BeginFrame(Types::UI32 imageIndex);
-        void EndFrame(Types::UI32 imageIndex);
-        void RecordCommands(VulkanRenderPass& renderPass, VulkanFramebuffer& framebuffer, VulkanSwapchain& swapchain, Types::UI32 imageIndex, const Types::Vec4<Types::F32>& clear);
+        void Create(VulkanDevice& device, VulkanQueues& queues, const VulkanQueueScheduler& scheduler, Types::UI32 frameCount, Types::UI32 threadCount);
+        void BeginFrame(Types::UI32 frame);
+        void EndFrame(Types::UI32 frame);
+        void RecordCommands(VulkanRenderPass& renderPass, VulkanFramebuffer& framebuffer, VulkanSwapchain& swapchain, const VulkanBarrierPlanner& barriers, const VulkanQueueScheduler& scheduler, std::span<const vk::Image> images, Types::UI32 frame, Types::UI32 passPosition, const Types::Vec4<Types::F32>& clear, const VulkanDrawList& draws = {});
+
+        template <typename Function>
+        void RecordParallel(vk::CommandBuffer primary, Types::UI32 frame, const vk::RenderPassBeginInfo& renderPassBeginInfo, Types::UI64 count, Types::UI64 grainSize, Function&& function);
 
         void Reset();
 
-        void SubmitFrame(vk::Queue graphicsQueue, const VulkanFrameSubmitDescriptor& info);
+        vk::CommandBuffer GetCommandBuffer(Types::UI32 frame, Types::UI32 batch) const;
+        vk::CommandPool GetCommandPool(Types::UI32 frame, Types::UI32 thread, Types::UI32 queue) const;
 
-        vk::CommandBuffer& GetCommandBuffer(Types::UI32 imageIndex);
+        Types::UI32 GetFrameCount() const;
+        Types::UI32 GetThreadCount() const;
 
     private:
-        vk::UniqueCommandPool mCommandPool;
-        std::vector<vk::UniqueCommandBuffer> mCommandBuffers;
+        vk::CommandBuffer AcquireSecondary(Types::UI32 frame, Types::UI32 thread);
+
+        vk::Device mDevice;
+
+        std::vector<VulkanCommandFrame> mFrames;
     };
 }
+
+#include "rendering/vulkan/commands.inl"
\ No newline at end of file
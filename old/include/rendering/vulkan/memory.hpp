@@ -0,0 +1,104 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    class VulkanPhysicalDevice;
+    class VulkanDevice;
+
+    enum class VulkanMemoryUsage
+    {
+        DeviceLocal,
+        Upload,
+        Readback,
+    };
+
+    struct VulkanAllocation
+    {
+        static constexpr Types::UI32 Dedicated = ~0u;
+
+        vk::DeviceMemory Memory;
+        vk::DeviceSize Offset = 0;
+        vk::DeviceSize Size = 0;
+
+        std::byte* Mapped = nullptr;
+
+        Types::UI32 MemoryType = 0;
+        Types::UI32 Block = Dedicated;
+        Types::UI32 Order = 0;
+    };
+
+    struct VulkanMemoryStatistics
+    {
+        Types::UI64 BlockCount = 0;
+        Types::UI64 DedicatedCount = 0;
+        Types::UI64 AllocationCount = 0;
+
+        Types::UI64 ReservedBytes = 0;
+        Types::UI64 UsedBytes = 0;
+    };
+
+    class VulkanMemoryAllocator
+    {
+    public:
+        void Create(VulkanPhysicalDevice& physicalDevice, VulkanDevice& device, vk::DeviceSize blockSize = DefaultBlockSize);
+        void Reset();
+
+        VulkanAllocation Allocate(const vk::MemoryRequirements& requirements, VulkanMemoryUsage usage, bool dedicated = false);
+        void Free(VulkanAllocation& allocation);
+
+        vk::UniqueBuffer CreateBuffer(const vk::BufferCreateInfo& createInfo, VulkanMemoryUsage usage, VulkanAllocation& allocation);
+        vk::UniqueImage CreateImage(const vk::ImageCreateInfo& createInfo, VulkanMemoryUsage usage, VulkanAllocation& allocation);
+
+        VulkanMemoryStatistics GetStatistics() const;
+
+        static constexpr vk::DeviceSize DefaultBlockSize = 64ull * 1024 * 1024;
+        static constexpr vk::DeviceSize MinimumAllocationSize = 256;
+
+    private:
+        struct Block
+        {
+            vk::UniqueDeviceMemory Memory;
+
+            std::byte* Mapped;
+
+            Types::UI32 MemoryType;
+
+            std::vector<std::set<vk::DeviceSize>> FreeOffsets;
+        };
+
+        Types::UI32 FindMemoryType(Types::UI32 typeBits, VulkanMemoryUsage usage) const;
+
+        VulkanAllocation AllocateDedicated(vk::DeviceSize size, Types::UI32 memoryType, const void* next);
+        VulkanAllocation AllocateFromBlocks(vk::DeviceSize size, Types::UI32 memoryType);
+
+        vk::UniqueDeviceMemory AllocateMemory(vk::DeviceSize size, Types::UI32 memoryType, const void* next, std::byte*& mapped);
+
+        Types::UI32 GetOrder(vk::DeviceSize size) const;
+
+        vk::Device mDevice;
+        vk::PhysicalDeviceMemoryProperties mMemoryProperties;
+
+        vk::DeviceSize mBlockSize;
+        vk::DeviceSize mMinimumSize;
+
+        Types::UI32 mMaxOrder;
+        Types::UI32 mMaxAllocations;
+
+        std::vector<std::unique_ptr<Block>> mBlocks;
+        std::vector<vk::UniqueDeviceMemory> mDedicated;
+
+        VulkanMemoryStatistics mStatistics;
+
+        mutable std::mutex mMutex;
+    };
+}
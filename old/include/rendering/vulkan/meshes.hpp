@@ -0,0 +1,75 @@
+#pragma once
+
+#include "rendering/vulkan/memory.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <future>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    struct RendererMeshUpload;
+
+    class VulkanQueues;
+    class VulkanStagingRing;
+
+    struct VulkanMeshBuffers
+    {
+        std::vector<vk::UniqueBuffer> Streams;
+        std::vector<VulkanAllocation> StreamAllocations;
+
+        vk::UniqueBuffer Indices;
+        VulkanAllocation IndexAllocation;
+
+        Types::UI64 Generation = 0;
+        Types::UI64 LastRead = 0;
+
+        std::shared_future<void> Resident;
+    };
+
+    class VulkanMeshCache
+    {
+    public:
+        void Create(const VulkanQueues& queues, VulkanMemoryAllocator& memory, VulkanStagingRing& staging);
+        void Reset();
+
+        void Apply(const RendererMeshUpload& upload);
+
+        const VulkanMeshBuffers* Find(Types::UI64 mesh) const;
+
+        bool IsResident(Types::UI64 mesh) const;
+
+        void MarkRead(Types::UI64 mesh, Types::UI64 value);
+
+        Types::UI64 GetTransferWait() const;
+
+        void Evict(std::span<const Types::UI64> meshes);
+
+        void EndFrame();
+
+        static constexpr Types::UI64 RetireFrames = 3;
+
+    private:
+        void CreateBuffers(const RendererMeshUpload& upload, VulkanMeshBuffers& buffers);
+        void Release(VulkanMeshBuffers& buffers);
+
+        vk::UniqueBuffer CreateBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage, VulkanAllocation& allocation);
+
+        VulkanMemoryAllocator* mMemory = nullptr;
+        VulkanStagingRing* mStaging = nullptr;
+
+        std::vector<Types::UI32> mFamilies;
+
+        std::unordered_map<Types::UI64, VulkanMeshBuffers> mMeshes;
+        std::vector<std::pair<Types::UI64, VulkanMeshBuffers>> mRetired;
+
+        Types::UI64 mFrame = 0;
+        Types::UI64 mTransferWait = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "rendering/pipeline.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    class VulkanPhysicalDevice;
+    class VulkanDevice;
+    class VulkanRenderPass;
+
+    struct VulkanPipelineCacheHeader
+    {
+        std::array<char, 4> Magic;
+        Types::UI32 Version;
+
+        Types::UI32 VendorID;
+        Types::UI32 DeviceID;
+        Types::UI32 DriverVersion;
+
+        std::array<Types::UI8, VK_UUID_SIZE> CacheUUID;
+
+        Types::UI64 DataSize;
+        Types::UI64 DataHash;
+    };
+
+    class VulkanPipelineCache
+    {
+    public:
+        VulkanPipelineCache() = default;
+        ~VulkanPipelineCache();
+
+        VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+        VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+        void Create(VulkanPhysicalDevice& physicalDevice, VulkanDevice& device, const std::string& directory);
+        void Reset();
+
+        void Update();
+        void Save();
+
+        vk::PipelineCache Get() const;
+
+        const std::string& GetPath() const;
+
+        static constexpr std::array<char, 4> Magic = {'M', 'P', 'S', 'O'};
+        static constexpr Types::UI32 Version = 1;
+
+        static constexpr std::chrono::seconds SaveInterval{60};
+
+    private:
+        std::vector<std::byte> Load() const;
+
+        bool Validate(std::span<const std::byte> file) const;
+
+        vk::Device mDevice;
+        vk::UniquePipelineCache mCache;
+
+        VulkanPipelineCacheHeader mHeader = {};
+
+        std::string mPath;
+
+        Types::UI64 mSavedSize = 0;
+
+        std::chrono::steady_clock::time_point mLastSave;
+    };
+
+    class VulkanPipelineStates
+    {
+    public:
+        void Create(VulkanDevice& device, VulkanPipelineCache& cache, VulkanRenderPass& renderPass);
+        void Reset();
+
+        vk::Pipeline Acquire(const std::shared_ptr<const PipelineSnapshot>& pipeline);
+        void Prewarm(std::span<const Pipeline> pipelines);
+
+        PipelineStateCache<vk::UniquePipeline>& GetStates();
+        vk::PipelineLayout GetLayout() const;
+
+    private:
+        vk::UniquePipeline Compile(const PipelineDescriptor& descriptor) const;
+
+        static vk::ShaderStageFlagBits GetStage(ShaderStage stage);
+        static vk::PrimitiveTopology GetTopology(PrimitiveTopology topology);
+        static vk::CullModeFlags GetCullMode(CullMode cull);
+        static vk::CompareOp GetCompareOp(CompareOperation compare);
+        static vk::PipelineColorBlendAttachmentState GetBlendState(BlendMode blend);
+
+        vk::Device mDevice;
+        vk::PipelineCache mCache;
+        vk::RenderPass mRenderPass;
+
+        vk::UniquePipelineLayout mLayout;
+
+        PipelineStateCache<vk::UniquePipeline> mStates;
+    };
+}
\ No newline at end of file
@@ -10,6 +10,13 @@ namespace Mosaic::Internal::Rendering
     class VulkanDevice;
     class VulkanSurface;
 
+    enum class VulkanQueueType
+    {
+        Graphics,
+        Compute,
+        Transfer,
+    };
+
     class VulkanQueues
     {
     public:
@@ -27,6 +34,11 @@ namespace Mosaic::Internal::Rendering
         Types::UI32 GetTransferQueueFamily() const;
         Types::UI32 GetPresentQueueFamily() const;
 
+        vk::Queue GetQueue(VulkanQueueType type) const;
+        Types::UI32 GetQueueFamily(VulkanQueueType type) const;
+
+        VulkanQueueType Resolve(VulkanQueueType type) const;
+
         std::vector<vk::DeviceQueueCreateInfo>& GetQueueCreateInfo();
 
     private:
@@ -2,50 +2,73 @@
 
 #include "rendering/renderer.hpp"
 
+#include "rendering/graph.hpp"
+
+#include "rendering/vulkan/barriers.hpp"
 #include "rendering/vulkan/commands.hpp"
 #include "rendering/vulkan/devices.hpp"
 #include "rendering/vulkan/instance.hpp"
+#include "rendering/vulkan/memory.hpp"
+#include "rendering/vulkan/meshes.hpp"
+#include "rendering/vulkan/pipelines.hpp"
 #include "rendering/vulkan/queues.hpp"
+#include "rendering/vulkan/scheduler.hpp"
+#include "rendering/vulkan/staging.hpp"
 #include "rendering/vulkan/surface.hpp"
 #include "rendering/vulkan/swapchain.hpp"
 
 #include "utilities/numerics.hpp"
 #include "utilities/vector.hpp"
 
-namespace Mosaic::Internal::Windowing
-{
-    struct WindowResizeEvent;
-}
-
 namespace Mosaic::Internal::Rendering
 {
     class VulkanRenderer : public RendererInterface
     {
     public:
         VulkanRenderer(Renderer& renderer);
+        ~VulkanRenderer() override;
 
     private:
         void Create() override;
         void Update() override;
         void LoadConfig() override;
+        void PrewarmPipelines(std::span<const Pipeline> pipelines) override;
 
         void CreateSwapchain();
-
-        void ResizeCallback(const Windowing::WindowResizeEvent& event);
+        void CreateFrameGraph();
+        void CreateTransientResources();
+        void BindTransientResources(const CompiledRenderGraph& compiled);
 
         Types::Vec2<Types::UI32> mWindowSize;
         VulkanInstance mInstance;
         VulkanPhysicalDevice mPhysicalDevice;
         VulkanDevice mDevice;
         VulkanQueues mQueues;
+        VulkanMemoryAllocator mMemory;
+        VulkanPipelineCache mPipelineCache;
+        VulkanStagingRing mStaging;
+        VulkanMeshCache mMeshes;
         VulkanSurface mSurface;
         VulkanSwapchain mSwapchain;
         VulkanRenderPass mRenderPass;
+        VulkanPipelineStates mPipelineStates;
         VulkanCommandSystem mCommandSystem;
+        VulkanBarrierPlanner mBarriers;
+        VulkanQueueScheduler mScheduler;
+        LocalRenderGraph mFrameGraph;
         Renderer& mRenderer;
 
+        std::vector<vk::UniqueImage> mTransientImages;
+        std::vector<vk::UniqueBuffer> mTransientBuffers;
+        VulkanAllocation mTransientAllocation;
+
+        Types::UI32 mTransientMemoryTypes;
+
         std::vector<VulkanFramebuffer> mFramebuffers;
 
+        Types::UI32 mSwapchainResource;
+        Types::UI32 mClearPosition;
+
         bool mRebuildSwapchainSuboptimal;
         bool mRebuildSwapchainOutOfDate;
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "rendering/graph.hpp"
+
+#include "rendering/vulkan/barriers.hpp"
+#include "rendering/vulkan/queues.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    class VulkanDevice;
+
+    struct VulkanQueueWait
+    {
+        VulkanQueueType Queue;
+
+        Types::UI64 Value;
+
+        vk::PipelineStageFlags2 Stages;
+    };
+
+    struct VulkanQueueBatch
+    {
+        VulkanQueueType Queue;
+
+        Types::UI32 FirstPosition;
+        Types::UI32 PositionCount;
+
+        Types::UI64 Value;
+
+        std::vector<VulkanQueueWait> Waits;
+    };
+
+    struct VulkanBatchSubmitDescriptor
+    {
+        std::span<const vk::CommandBuffer> Commands;
+        std::span<const vk::SemaphoreSubmitInfo> Waits;
+        std::span<const vk::SemaphoreSubmitInfo> Signals;
+
+        vk::Fence Fence;
+    };
+
+    class VulkanQueueScheduler
+    {
+    public:
+        void Create(VulkanDevice& device);
+        void Reset();
+
+        void Schedule(const LocalRenderGraph& graph, const CompiledRenderGraph& compiled, const VulkanQueues& queues);
+
+        void Submit(const VulkanQueues& queues, Types::UI32 batch, const VulkanBatchSubmitDescriptor& descriptor);
+        void EndFrame();
+
+        const std::vector<VulkanQueueBatch>& GetBatches() const;
+        const std::vector<VulkanPassQueue>& GetPassQueues() const;
+
+        Types::UI32 GetFirstBatch(VulkanQueueType queue) const;
+        Types::UI32 GetLastBatch(VulkanQueueType queue) const;
+
+        vk::Semaphore GetTimeline(VulkanQueueType queue) const;
+        Types::UI64 GetFrameValue(VulkanQueueType queue) const;
+
+        static vk::PipelineStageFlags2 GetSupportedStages(VulkanQueueType queue);
+
+        static constexpr Types::UI32 NoBatch = ~0u;
+
+    private:
+        static constexpr Types::UI32 QueueCount = 3;
+
+        VulkanQueueType Assign(const RenderGraphPass& pass, const VulkanQueues& queues) const;
+
+        std::vector<VulkanQueueBatch> mBatches;
+        std::vector<VulkanPassQueue> mPassQueues;
+        std::vector<Types::UI32> mPositionBatches;
+
+        std::array<vk::UniqueSemaphore, QueueCount> mTimelines;
+        std::array<Types::UI64, QueueCount> mTimelineBases = {};
+        std::array<Types::UI64, QueueCount> mFrameValues = {};
+    };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "rendering/vulkan/memory.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Mosaic::Internal::Rendering
+{
+    class VulkanDevice;
+    class VulkanQueues;
+
+    struct VulkanStagingStatistics
+    {
+        Types::UI64 UploadedBytes = 0;
+        Types::UI64 Copies = 0;
+        Types::UI64 Submissions = 0;
+        Types::UI64 DeferredUploads = 0;
+    };
+
+    class VulkanStagingRing
+    {
+    public:
+        void Create(VulkanDevice& device, const VulkanQueues& queues, VulkanMemoryAllocator& memory, Types::UI32 frameCount, vk::DeviceSize capacity = DefaultCapacity);
+        void Reset();
+
+        std::shared_future<void> Upload(std::span<const std::byte> data, vk::Buffer destination, vk::DeviceSize destinationOffset);
+
+        void BeginFrame(Types::UI32 frame);
+        vk::SemaphoreSubmitInfo Flush(const VulkanQueues& queues, Types::UI32 frame, const vk::SemaphoreSubmitInfo& wait = {});
+
+        VulkanStagingStatistics GetStatistics() const;
+
+        static constexpr vk::DeviceSize DefaultCapacity = 32ull * 1024 * 1024;
+        static constexpr vk::DeviceSize CopyAlignment = 16;
+
+    private:
+        struct PendingCopy
+        {
+            vk::Buffer Destination;
+            vk::BufferCopy Region;
+        };
+
+        struct DeferredUpload
+        {
+            std::vector<std::byte> Data;
+
+            vk::Buffer Destination;
+            vk::DeviceSize DestinationOffset;
+
+            std::shared_ptr<std::promise<void>> Completion;
+        };
+
+        struct Frame
+        {
+            vk::UniqueCommandPool Pool;
+            vk::CommandBuffer Commands;
+            vk::UniqueFence Fence;
+
+            vk::DeviceSize Bytes = 0;
+
+            std::vector<std::shared_ptr<std::promise<void>>> Completions;
+
+            bool Submitted = false;
+        };
+
+        bool Stage(std::span<const std::byte> data, vk::Buffer destination, vk::DeviceSize destinationOffset, const std::shared_ptr<std::promise<void>>& completion);
+
+        vk::DeviceSize Reserve(vk::DeviceSize size);
+
+        static constexpr vk::DeviceSize NoSpace = ~0ull;
+
+        vk::Device mDevice;
+
+        VulkanMemoryAllocator* mMemory = nullptr;
+
+        vk::UniqueBuffer mBuffer;
+        VulkanAllocation mAllocation;
+
+        vk::UniqueSemaphore mTimeline;
+        Types::UI64 mTimelineValue = 0;
+
+        vk::DeviceSize mCapacity = 0;
+        vk::DeviceSize mHead = 0;
+        vk::DeviceSize mUsed = 0;
+        vk::DeviceSize mPendingBytes = 0;
+
+        std::vector<PendingCopy> mPending;
+        std::vector<std::shared_ptr<std::promise<void>>> mPendingCompletions;
+        std::deque<DeferredUpload> mDeferred;
+
+        std::vector<Frame> mFrames;
+
+        VulkanStagingStatistics mStatistics;
+
+        mutable std::mutex mMutex;
+    };
+}
\ No newline at end of file
@@ -76,6 +76,8 @@ namespace Mosaic::Internal::Rendering
 
         void IncrementFrame();
 
+        static constexpr Types::UI32 MaxFramesInFlight = 3;
+
     private:
         vk::UniqueSwapchainKHR mSwapchain;
         vk::Extent2D mSwapchainExtent;
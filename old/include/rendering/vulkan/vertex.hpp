@@ -0,0 +1,26 @@
+#pragma once
+
+#include "rendering/mesh.hpp"
+
+#include "utilities/numerics.hpp"
+
+#include <vulkan/vulkan.hpp>
+
+#include <vector>
+
+namespace Mosaic::Internal::Rendering
+{
+    class VulkanVertexInput
+    {
+    public:
+        void Create(const VertexLayoutDescriptor& layout);
+
+        vk::PipelineVertexInputStateCreateInfo GetCreateInfo() const;
+
+        static vk::Format GetFormat(VertexAttributeType type, Types::UI32 componentCount);
+
+    private:
+        std::vector<vk::VertexInputBindingDescription> mBindings;
+        std::vector<vk::VertexInputAttributeDescription> mAttributes;
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+#include "utilities/vector.hpp"
+
+#include <span>
+
+namespace Mosaic::Internal::Conversions
+{
+    void Convert(std::span<const Types::F32> input, std::span<Types::F16> output);
+    void Convert(std::span<const Types::F16> input, std::span<Types::F32> output);
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::UNorm8> output);
+    void Convert(std::span<const Types::UNorm8> input, std::span<Types::F32> output);
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::UNorm16> output);
+    void Convert(std::span<const Types::UNorm16> input, std::span<Types::F32> output);
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::SNorm8> output);
+    void Convert(std::span<const Types::SNorm8> input, std::span<Types::F32> output);
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::SNorm16> output);
+    void Convert(std::span<const Types::SNorm16> input, std::span<Types::F32> output);
+
+    void Convert(std::span<const Types::Vec4<Types::F32>> input, std::span<Types::UNorm1010102> output);
+    void Convert(std::span<const Types::UNorm1010102> input, std::span<Types::Vec4<Types::F32>> output);
+
+    void Convert(std::span<const Types::Vec4<Types::F32>> input, std::span<Types::SNorm1010102> output);
+    void Convert(std::span<const Types::SNorm1010102> input, std::span<Types::Vec4<Types::F32>> output);
+}
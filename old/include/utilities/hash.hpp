@@ -0,0 +1,23 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace Mosaic::Internal::Hashing
+{
+    inline constexpr Types::UI64 FNV1aOffsetBasis = 0xCBF29CE484222325ull;
+    inline constexpr Types::UI64 FNV1aPrime = 0x00000100000001B3ull;
+
+    constexpr Types::UI64 FNV1a(std::span<const std::byte> data, Types::UI64 seed = FNV1aOffsetBasis);
+    constexpr Types::UI64 FNV1a(std::string_view data, Types::UI64 seed = FNV1aOffsetBasis);
+
+    template <typename T>
+    Types::UI64 FNV1a(const T& value, Types::UI64 seed = FNV1aOffsetBasis);
+
+    constexpr Types::UI64 Combine(Types::UI64 seed, Types::UI64 value);
+}
+
+#include "utilities/hash.inl"
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Mosaic::Internal::Files
+{
+    class JsonValue
+    {
+    public:
+        using Array = std::vector<JsonValue>;
+        using Object = std::vector<std::pair<std::string, JsonValue>>;
+
+        JsonValue() = default;
+
+        static JsonValue Parse(std::string_view text);
+
+        bool IsNull() const;
+        bool IsBool() const;
+        bool IsNumber() const;
+        bool IsString() const;
+        bool IsArray() const;
+        bool IsObject() const;
+
+        bool Contains(std::string_view key) const;
+
+        const JsonValue& operator[](std::string_view key) const;
+        const JsonValue& operator[](Types::UI64 index) const;
+
+        Types::UI64 Size() const;
+
+        bool AsBool(bool fallback = false) const;
+        Types::F64 AsNumber(Types::F64 fallback = 0.0) const;
+        Types::UI64 AsUnsigned(Types::UI64 fallback = 0) const;
+        const std::string& AsString() const;
+
+        const Array& AsArray() const;
+        const Object& AsObject() const;
+
+    private:
+        std::variant<std::monostate, bool, Types::F64, std::string, Array, Object> mValue;
+
+        friend class JsonParser;
+    };
+}
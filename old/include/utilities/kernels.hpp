@@ -0,0 +1,82 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+#include "utilities/vector.hpp"
+
+#include <array>
+#include <span>
+
+namespace Mosaic::Internal::Kernels
+{
+    template <TypeConcepts::Numeric T>
+    struct Vec3Lanes
+    {
+        std::span<T> X;
+        std::span<T> Y;
+        std::span<T> Z;
+
+        Types::UI64 Size() const;
+
+        Vec3Lanes Subspan(Types::UI64 offset) const;
+    };
+
+    template <TypeConcepts::Numeric T>
+    struct ConstVec3Lanes
+    {
+        ConstVec3Lanes(std::span<const T> x, std::span<const T> y, std::span<const T> z);
+        ConstVec3Lanes(const Vec3Lanes<T>& lanes);
+
+        std::span<const T> X;
+        std::span<const T> Y;
+        std::span<const T> Z;
+
+        Types::UI64 Size() const;
+
+        ConstVec3Lanes Subspan(Types::UI64 offset) const;
+    };
+
+    template <TypeConcepts::Numeric T>
+    struct Bounds
+    {
+        Types::Vec3<T> Min;
+        Types::Vec3<T> Max;
+    };
+
+    template <TypeConcepts::Numeric T>
+    struct AffineTransform
+    {
+        std::array<T, 12> Elements;
+    };
+
+    template <TypeConcepts::Numeric T>
+    void Transform(const AffineTransform<T>& transform, ConstVec3Lanes<T> input, Vec3Lanes<T> output);
+
+    template <TypeConcepts::Numeric T>
+    void IntegrateVelocity(Vec3Lanes<T> positions, ConstVec3Lanes<T> velocities, T deltaTime);
+
+    template <TypeConcepts::Numeric T>
+    Bounds<T> ComputeBounds(ConstVec3Lanes<T> points);
+
+    template <TypeConcepts::Numeric T>
+    void DistanceSquared(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, std::span<T> output);
+
+    template <TypeConcepts::Numeric T>
+    Types::UI64 WithinDistance(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, T radius, std::span<Types::UI8> mask);
+
+    template <>
+    void Transform<Types::F32>(const AffineTransform<Types::F32>& transform, ConstVec3Lanes<Types::F32> input, Vec3Lanes<Types::F32> output);
+
+    template <>
+    void IntegrateVelocity<Types::F32>(Vec3Lanes<Types::F32> positions, ConstVec3Lanes<Types::F32> velocities, Types::F32 deltaTime);
+
+    template <>
+    Bounds<Types::F32> ComputeBounds<Types::F32>(ConstVec3Lanes<Types::F32> points);
+
+    template <>
+    void DistanceSquared<Types::F32>(ConstVec3Lanes<Types::F32> points, const Types::Vec3<Types::F32>& origin, std::span<Types::F32> output);
+
+    template <>
+    Types::UI64 WithinDistance<Types::F32>(ConstVec3Lanes<Types::F32> points, const Types::Vec3<Types::F32>& origin, Types::F32 radius, std::span<Types::UI8> mask);
+}
+
+#include "utilities/kernels.inl"
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace Mosaic::Internal::Files
+{
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        void Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const;
+
+        std::span<const std::byte> GetData() const;
+
+    private:
+        const std::byte* mData = nullptr;
+        Types::UI64 mSize = 0;
+
+#ifdef WINDOWS
+        void* mFileHandle = nullptr;
+        void* mMappingHandle = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Mosaic::Internal::Memory
+{
+    void StridedCopy(std::byte* destination, Types::UI64 destinationStride, const std::byte* source, Types::UI64 sourceStride, Types::UI64 elementSize, Types::UI64 count);
+
+    class LinearAllocator
+    {
+    public:
+        LinearAllocator(Types::UI64 blockSize = DefaultBlockSize);
+
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+        LinearAllocator(LinearAllocator&&) = default;
+        LinearAllocator& operator=(LinearAllocator&&) = default;
+
+        void* Allocate(Types::UI64 size, Types::UI64 alignment);
+
+        template <typename T, typename... Args>
+        inline T* Create(Args&&... args);
+
+        void Reset();
+
+        Types::UI64 GetUsedBytes() const;
+        Types::UI64 GetReservedBytes() const;
+
+        static constexpr Types::UI64 DefaultBlockSize = 64 * 1024;
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> Data;
+
+            Types::UI64 Size;
+        };
+
+        std::vector<Block> mBlocks;
+
+        Types::UI64 mBlockIndex;
+        Types::UI64 mOffset;
+        Types::UI64 mBlockSize;
+        Types::UI64 mUsedBytes;
+    };
+}
+
+#include "utilities/memory.inl"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 namespace Mosaic::Internal::Types
 {
     using I8 = char;
@@ -14,4 +16,142 @@ namespace Mosaic::Internal::Types
 
     using F32 = float;
     using F64 = double;
-}
\ No newline at end of file
+
+    class F16
+    {
+    public:
+        constexpr F16();
+        constexpr F16(F32 value);
+
+        constexpr operator F32() const;
+
+        static constexpr F16 FromBits(UI16 bits);
+
+        UI16 Bits;
+    };
+
+    template <typename T>
+    class UNorm
+    {
+    public:
+        using StorageType = T;
+
+        static constexpr T Maximum = static_cast<T>(~T(0));
+
+        constexpr UNorm();
+        constexpr UNorm(F32 value);
+
+        constexpr operator F32() const;
+
+        T Value;
+    };
+
+    template <typename T>
+    class SNorm
+    {
+    public:
+        using StorageType = T;
+
+        static constexpr T Maximum = static_cast<T>((1u << (sizeof(T) * 8 - 1)) - 1);
+
+        constexpr SNorm();
+        constexpr SNorm(F32 value);
+
+        constexpr operator F32() const;
+
+        T Value;
+    };
+
+    using UNorm8 = UNorm<UI8>;
+    using UNorm16 = UNorm<UI16>;
+    using SNorm8 = SNorm<signed char>;
+    using SNorm16 = SNorm<I16>;
+
+    class UNorm1010102
+    {
+    public:
+        constexpr UNorm1010102();
+        constexpr UNorm1010102(F32 x, F32 y, F32 z, F32 w);
+
+        constexpr F32 Get(UI32 component) const;
+
+        UI32 Bits;
+    };
+
+    class SNorm1010102
+    {
+    public:
+        constexpr SNorm1010102();
+        constexpr SNorm1010102(F32 x, F32 y, F32 z, F32 w);
+
+        constexpr F32 Get(UI32 component) const;
+
+        UI32 Bits;
+    };
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<Mosaic::Internal::Types::F16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+
+        static constexpr int digits = 11;
+        static constexpr int radix = 2;
+
+        static constexpr Mosaic::Internal::Types::F16 min() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 max() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 lowest() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 epsilon() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 infinity() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 quiet_NaN() noexcept;
+        static constexpr Mosaic::Internal::Types::F16 denorm_min() noexcept;
+    };
+
+    template <typename T>
+    class numeric_limits<Mosaic::Internal::Types::UNorm<T>>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = false;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = true;
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+
+        static constexpr int digits = numeric_limits<T>::digits;
+        static constexpr int radix = 2;
+
+        static constexpr Mosaic::Internal::Types::UNorm<T> min() noexcept;
+        static constexpr Mosaic::Internal::Types::UNorm<T> max() noexcept;
+        static constexpr Mosaic::Internal::Types::UNorm<T> lowest() noexcept;
+    };
+
+    template <typename T>
+    class numeric_limits<Mosaic::Internal::Types::SNorm<T>>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = true;
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+
+        static constexpr int digits = numeric_limits<T>::digits;
+        static constexpr int radix = 2;
+
+        static constexpr Mosaic::Internal::Types::SNorm<T> min() noexcept;
+        static constexpr Mosaic::Internal::Types::SNorm<T> max() noexcept;
+        static constexpr Mosaic::Internal::Types::SNorm<T> lowest() noexcept;
+    };
+}
+
+#include "utilities/numerics.inl"
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace Mosaic::Internal::SIMD
+{
+    enum class InstructionSet
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512,
+    };
+
+    InstructionSet DetectInstructionSet();
+
+    InstructionSet GetInstructionSet();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Mosaic::Internal::Threading
+{
+    class ThreadPool
+    {
+    public:
+        ThreadPool();
+        ThreadPool(Types::UI32 workerCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        template <typename Function>
+        std::future<std::invoke_result_t<Function>> Submit(Function&& function);
+
+        template <typename Function>
+        void ParallelFor(Types::UI64 count, Types::UI64 grainSize, Function&& function);
+
+        Types::UI32 GetWorkerCount() const;
+
+        static ThreadPool& GetShared();
+
+    private:
+        void Enqueue(std::move_only_function<void()>&& task);
+
+        void WorkerLoop(std::stop_token stop);
+
+        std::vector<std::jthread> mWorkers;
+        std::queue<std::move_only_function<void()>> mTasks;
+
+        std::mutex mMutex;
+        std::condition_variable_any mCondition;
+    };
+
+    template <typename T, Types::UI32 Count = 3>
+    class BufferedExchange
+    {
+    public:
+        static_assert(Count >= 2, "Buffered exchanges need at least two slots");
+
+        T& BeginWrite();
+        void EndWrite();
+
+        T* BeginRead(std::stop_token stop);
+        void EndRead();
+
+    private:
+        std::array<T, Count> mSlots;
+
+        Types::UI32 mWriteIndex = 0;
+        Types::UI32 mReadIndex = 0;
+        Types::UI32 mReadable = 0;
+        Types::UI32 mOccupied = 0;
+
+        std::mutex mMutex;
+        std::condition_variable_any mCondition;
+    };
+}
+
+#include "utilities/threading.inl"
@@ -70,6 +70,48 @@ namespace Mosaic::Internal::TypeChecks
         static constexpr bool Result = true;
     };
 
+    template <>
+    struct IsNumeric<Types::F16>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::UNorm8>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::UNorm16>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::SNorm8>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::SNorm16>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::UNorm1010102>
+    {
+        static constexpr bool Result = true;
+    };
+
+    template <>
+    struct IsNumeric<Types::SNorm1010102>
+    {
+        static constexpr bool Result = true;
+    };
+
     template <typename T>
     constexpr bool IsNumericV = IsNumeric<T>::Result;
 }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "rendering/commands.hpp"
+
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Mosaic::Internal::Rendering
+{
+    template <typename Function>
+    void RendererCommandManager::Record(Types::UI64 count, Types::UI64 grainSize, Function&& function)
+    {
+        grainSize = std::max<Types::UI64>(grainSize, 1);
+
+        Threading::ThreadPool& pool = Threading::ThreadPool::GetShared();
+
+        const Types::UI64 chunkCount = (count + grainSize - 1) / grainSize;
+
+        ReserveWriters(std::min<Types::UI64>(chunkCount, pool.GetWorkerCount() + 1));
+
+        std::mutex mutex;
+        std::unordered_map<std::thread::id, RendererCommandWriter*> assigned;
+
+        auto record = [&](Types::UI64 first, Types::UI64 last)
+        {
+            RendererCommandWriter* writer;
+
+            {
+                std::lock_guard lock(mutex);
+
+                auto [found, inserted] = assigned.try_emplace(std::this_thread::get_id(), nullptr);
+
+                if (inserted)
+                {
+                    found->second = mWriters[assigned.size() - 1].get();
+                }
+
+                writer = found->second;
+            }
+
+            writer->BeginChunk(first / grainSize);
+
+            function(*writer, first, last);
+        };
+
+        pool.ParallelFor(count, grainSize, record);
+    }
+}
@@ -4,6 +4,31 @@
 
 #include "application/console.hpp"
 
+#include "utilities/memory.hpp"
+#include "utilities/threading.hpp"
+
+#include <cstring>
+
+namespace Mosaic::Internal::Rendering::Detail
+{
+    template <Types::UI64 N>
+    constexpr std::array<Types::UI32, N> ExclusivePrefixSum(const std::array<Types::UI32, N>& values)
+    {
+        std::array<Types::UI32, N> sums = {};
+
+        Types::UI32 total = 0;
+
+        for (Types::UI64 i = 0; i < N; i++)
+        {
+            sums[i] = total;
+
+            total += values[i];
+        }
+
+        return sums;
+    }
+}
+
 namespace Mosaic::Internal::Rendering
 {
     template <typename T>
@@ -33,6 +58,22 @@ namespace Mosaic::Internal::Rendering
         return *this;
     }
 
+    template <typename T>
+    VertexFormat& VertexFormat::AddAttribute(VertexAttribute<T>&& attribute, Types::UI32 stream)
+    {
+        attribute.RequestedStream = stream;
+
+        mAttributes.push_back(attribute);
+
+        return *this;
+    }
+
+    template <typename... Attributes>
+    StaticVertexFormat<Attributes...>::StaticVertexFormat()
+    {
+        (VertexFormat::AddAttribute(Attributes(1)), ...);
+    }
+
     template <typename... Args>
     void Mesh::SetVertexData(const std::vector<Args>&... data)
     {
@@ -48,7 +89,7 @@ namespace Mosaic::Internal::Rendering
             return;
         }
 
-        std::array<Types::UI32, NumInputs> attributeCounts = {};
+        std::array<Types::UI64, NumInputs> attributeCounts = {};
 
         if (not ValidateAttributeData<Args...>(data..., attributeCounts))
         {
@@ -60,16 +101,165 @@ namespace Mosaic::Internal::Rendering
             return;
         }
 
-        const Types::UI32 vertexCount = attributeCounts[0];
+        const auto dataTuple = std::tie(data...);
+
+        WriteVertexData(attributeCounts[0], [&](Types::UI64 first, Types::UI64 last)
+                        { InterleaveVertexData(first, last, first, std::make_index_sequence<NumInputs>{}, dataTuple); });
+    }
+
+    template <typename... Attributes, typename... Args>
+    void Mesh::SetVertexData(StaticVertexFormat<Attributes...>& format, const std::vector<Args>&... data)
+    {
+        using Format = StaticVertexFormat<Attributes...>;
+
+        static_assert(sizeof...(Args) == Format::AttributeCount, "Vertex data input count does not match the static vertex format");
+
+        static_assert(((AttributeInfo<typename AttributeInfo<Args>::Type>::EnumType == StaticAttributeInfo<Attributes>::EnumType) and ...), "Type mismatch between static vertex format and provided data");
+
+        static_assert(((StaticAttributeInfo<Attributes>::LengthBytes % sizeof(Args) == 0) and ...), "Vertex data elements do not evenly divide their static vertex attributes");
+
+        const std::array<Types::UI64, Format::AttributeCount> sizes = {(data.size() * sizeof(Args))...};
+
+        std::array<Types::UI64, Format::AttributeCount> attributeCounts = {};
+
+        for (Types::UI32 index = 0; index < Format::AttributeCount; index++)
+        {
+            if (sizes[index] == 0)
+            {
+                Console::LogWarning("Cannot provide empty data for mesh attribute");
+
+                return;
+            }
+
+            if (sizes[index] % Format::AttributeLengths[index] != 0)
+            {
+                Console::LogWarning("Data for attribute index {} is misaligned", index);
+
+                return;
+            }
+
+            attributeCounts[index] = sizes[index] / Format::AttributeLengths[index];
+        }
+
+        if (not ValidateVertexCounts(attributeCounts))
+        {
+            return;
+        }
+
+        if (not mFormat)
+        {
+            SetVertexFormat(format);
+        }
 
-        mRawData.reserve(vertexCount * mVertexLengthBytes);
+        if (mFormat != &format)
+        {
+            Console::LogWarning("Mesh is bound to a different vertex format than the one provided");
+
+            return;
+        }
+
+        const VertexLayoutDescriptor& layout = format.GetLayoutDescriptor();
+
+        if (layout.Streams.size() != 1 or layout.Streams[0].StrideBytes != Format::StrideBytes)
+        {
+            Console::LogWarning("Static vertex format layout no longer matches its attributes");
+
+            return;
+        }
+
+        if (not CanSetVertexData())
+        {
+            return;
+        }
 
         const auto dataTuple = std::tie(data...);
 
-        for (Types::UI32 vertex = 0; vertex < vertexCount; vertex++)
+        WriteVertexData(attributeCounts[0], [&](Types::UI64 first, Types::UI64 last)
+                        { InterleaveStaticVertexData<Format>(first, last, std::index_sequence_for<Args...>{}, dataTuple); });
+    }
+
+    template <typename Interleave>
+    void Mesh::WriteVertexData(Types::UI64 vertexCount, Interleave&& interleave)
+    {
+        AllocateStreams(vertexCount);
+
+        RevalidateIndices();
+
+        if (vertexCount < ParallelInterleaveThreshold)
+        {
+            interleave(0, vertexCount);
+        }
+        else
+        {
+            Threading::ThreadPool::GetShared().ParallelFor(vertexCount, ParallelInterleaveThreshold, interleave);
+        }
+
+        if (mUsage == MeshUsage::Dynamic)
         {
-            InterleaveVertexData(vertex, std::make_index_sequence<NumInputs>{}, dataTuple);
+            mDirtyVertexRanges.assign(1, {0, vertexCount});
         }
+
+        RefreshViews();
+    }
+
+    template <typename... Args>
+    void Mesh::UpdateRange(Types::UI64 first, Types::UI64 count, const std::vector<Args>&... data)
+    {
+        if (not CanUpdateRange())
+        {
+            return;
+        }
+
+        if (count == 0 or first + count > mVertexCount)
+        {
+            Console::LogWarning("Mesh update range [{}, {}) exceeds vertex count {}", first, first + count, mVertexCount);
+
+            return;
+        }
+
+        constexpr Types::UI64 NumInputs = sizeof...(Args);
+
+        if (not ValidateAttributeCount<NumInputs>())
+        {
+            return;
+        }
+
+        std::array<Types::UI64, NumInputs> attributeCounts = {};
+
+        if (not ValidateAttributeData<Args...>(data..., attributeCounts))
+        {
+            return;
+        }
+
+        for (Types::UI64 attributeCount : attributeCounts)
+        {
+            if (attributeCount != count)
+            {
+                Console::LogWarning("Mesh update data does not match the update range of {} vertices", count);
+
+                return;
+            }
+        }
+
+        DiscardDerivedData();
+
+        const auto dataTuple = std::tie(data...);
+
+        auto interleave = [&](Types::UI64 begin, Types::UI64 end)
+        {
+            InterleaveVertexData(begin, end, first + begin, std::make_index_sequence<NumInputs>{}, dataTuple);
+        };
+
+        if (count < ParallelInterleaveThreshold)
+        {
+            interleave(0, count);
+        }
+        else
+        {
+            Threading::ThreadPool::GetShared().ParallelFor(count, ParallelInterleaveThreshold, interleave);
+        }
+
+        MarkDirty(mDirtyVertexRanges, first, count);
     }
 
     template <Types::UI64 NumInputs>
@@ -85,7 +275,7 @@ namespace Mosaic::Internal::Rendering
     }
 
     template <typename... Args>
-    bool Mesh::ValidateAttributeData(const std::vector<Args>&... data, std::array<Types::UI32, sizeof...(Args)>& outCounts)
+    bool Mesh::ValidateAttributeData(const std::vector<Args>&... data, std::array<Types::UI64, sizeof...(Args)>& outCounts)
     {
         bool mismatch = false;
         Types::UI32 index = 0;
@@ -116,8 +306,8 @@ namespace Mosaic::Internal::Rendering
                 return;
             }
 
-            Types::UI32 vectorSizeBytes = vec.size() * sizeof(ArrayType);
-            Types::UI32 attributeLengthBytes = mFormat->mAttributes[index].LengthBytes;
+            Types::UI64 vectorSizeBytes = vec.size() * sizeof(ArrayType);
+            Types::UI64 attributeLengthBytes = mFormat->mAttributes[index].LengthBytes;
 
             if (vectorSizeBytes % attributeLengthBytes != 0)
             {
@@ -136,9 +326,9 @@ namespace Mosaic::Internal::Rendering
     }
 
     template <Types::UI64 NumInputs>
-    bool Mesh::ValidateVertexCounts(const std::array<Types::UI32, NumInputs>& counts)
+    bool Mesh::ValidateVertexCounts(const std::array<Types::UI64, NumInputs>& counts)
     {
-        const Types::UI32 vertexCount = counts[0];
+        const Types::UI64 vertexCount = counts[0];
         for (Types::UI32 i = 1; i < counts.size(); ++i)
         {
             if (vertexCount != counts[i])
@@ -151,33 +341,34 @@ namespace Mosaic::Internal::Rendering
     }
 
     template <Types::UI64... NumInputs, typename... Args>
-    void Mesh::InterleaveVertexData(Types::UI32 vertex, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple)
+    void Mesh::InterleaveVertexData(Types::UI64 first, Types::UI64 last, Types::UI64 destinationFirst, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple)
     {
-        (void)std::initializer_list<int>{
-            ([&]
-             {
-            const auto& vec = std::get<NumInputs>(dataTuple);
-            const auto& attribute = mFormat->mAttributes[NumInputs];
+        auto copyAttribute = [&](const auto& vec, const VertexAttributeBase& attribute)
+        {
+            const Types::UI64 lengthBytes = attribute.LengthBytes;
+            const Types::UI64 strideBytes = mFormat->mLayoutDescriptor.Streams[attribute.Stream].StrideBytes;
 
-            using VecT = std::decay_t<decltype(vec)>;
-            using ElemT = typename VecT::value_type;
-            constexpr bool isRaw = std::is_arithmetic_v<ElemT>;
+            const std::byte* source = reinterpret_cast<const std::byte*>(vec.data()) + first * lengthBytes;
+            std::byte* destination = mStreams[attribute.Stream].data() + destinationFirst * strideBytes + attribute.OffsetBytes;
 
-            Types::UI32 elementCount = attribute.LengthBytes / sizeof(typename AttributeInfo<ElemT>::Type);
+            Memory::StridedCopy(destination, strideBytes, source, lengthBytes, lengthBytes, last - first);
+        };
 
-            if constexpr (isRaw)
-            {
-                const auto* ptr = &vec[vertex * elementCount];
-                const std::byte* bytes = reinterpret_cast<const std::byte*>(ptr);
-                mRawData.insert(mRawData.end(), bytes, bytes + elementCount * sizeof(ElemT));
-            }
-            else
-            {
-                const auto& value = vec[vertex];
-                const std::byte* bytes = reinterpret_cast<const std::byte*>(&value);
-                mRawData.insert(mRawData.end(), bytes, bytes + attribute.LengthBytes);
-            }
+        (copyAttribute(std::get<NumInputs>(dataTuple), mFormat->mAttributes[NumInputs]), ...);
+    }
+
+    template <typename Format, Types::UI64... NumInputs, typename... Args>
+    void Mesh::InterleaveStaticVertexData(Types::UI64 first, Types::UI64 last, std::index_sequence<NumInputs...>, const std::tuple<const std::vector<Args>&...>& dataTuple)
+    {
+        std::byte* destination = mStreams[0].data() + first * Format::StrideBytes;
 
-            return 0; }(), 0)...};
+        const std::array<const std::byte*, sizeof...(Args)> sources = {(reinterpret_cast<const std::byte*>(std::get<NumInputs>(dataTuple).data()) + first * Format::AttributeLengths[NumInputs])...};
+
+        for (Types::UI64 vertex = 0; vertex < last - first; vertex++)
+        {
+            (std::memcpy(destination + Format::AttributeOffsets[NumInputs], sources[NumInputs] + vertex * Format::AttributeLengths[NumInputs], Format::AttributeLengths[NumInputs]), ...);
+
+            destination += Format::StrideBytes;
+        }
     }
 }
\ No newline at end of file
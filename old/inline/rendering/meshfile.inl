@@ -0,0 +1,19 @@
+#pragma once
+
+#include "rendering/meshfile.hpp"
+
+#include "application/console.hpp"
+
+namespace Mosaic::Internal::Rendering
+{
+    template <typename T>
+    std::span<const T> MeshFile::GetSection(std::span<const std::byte> file, const MeshFileSection& section)
+    {
+        if (section.Offset > file.size() or section.Size > file.size() - section.Offset or section.Size % sizeof(T) != 0 or section.Offset % alignof(T) != 0)
+        {
+            Console::Throw("Mesh file section at offset {} with size {} is malformed", section.Offset, section.Size);
+        }
+
+        return {reinterpret_cast<const T*>(file.data() + section.Offset), section.Size / sizeof(T)};
+    }
+}
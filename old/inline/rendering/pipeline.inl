@@ -0,0 +1,247 @@
+#pragma once
+
+#include "rendering/pipeline.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/threading.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace Mosaic::Internal::Rendering
+{
+    template <typename T>
+    PipelineStateCache<T>::~PipelineStateCache()
+    {
+        WaitIdle();
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::SetCompiler(Compiler compiler)
+    {
+        std::lock_guard lock(mMutex);
+
+        mCompiler = std::move(compiler);
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::SetMissPolicy(PipelineMissPolicy policy)
+    {
+        std::lock_guard lock(mMutex);
+
+        mMissPolicy = policy;
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::SetFallback(const Pipeline& pipeline)
+    {
+        {
+            std::lock_guard lock(mMutex);
+
+            mFallback = pipeline.GetHash();
+        }
+
+        Prewarm({&pipeline, 1});
+    }
+
+    template <typename T>
+    const T* PipelineStateCache<T>::Acquire(const std::shared_ptr<const PipelineSnapshot>& pipeline)
+    {
+        if (not pipeline or pipeline->Descriptor.Shaders.empty())
+        {
+            return nullptr;
+        }
+
+        std::lock_guard lock(mMutex);
+
+        Entry& entry = mEntries[pipeline->Hash];
+
+        if (entry.State == PipelineCompileState::Ready)
+        {
+            mStatistics.Hits++;
+
+            return &entry.Object;
+        }
+
+        if (entry.State == PipelineCompileState::Missing)
+        {
+            mStatistics.Misses++;
+
+            Compile(pipeline, entry);
+        }
+
+        if (mMissPolicy == PipelineMissPolicy::Fallback)
+        {
+            if (const T* fallback = Find(mFallback))
+            {
+                mStatistics.Fallbacks++;
+
+                return fallback;
+            }
+        }
+
+        mStatistics.Skips++;
+
+        return nullptr;
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::Prewarm(std::span<const Pipeline> pipelines)
+    {
+        std::lock_guard lock(mMutex);
+
+        for (const Pipeline& pipeline : pipelines)
+        {
+            if (not pipeline.IsValid())
+            {
+                continue;
+            }
+
+            Entry& entry = mEntries[pipeline.GetHash()];
+
+            if (entry.State == PipelineCompileState::Missing)
+            {
+                Compile(std::make_shared<const PipelineSnapshot>(pipeline.GetDescriptor()), entry);
+            }
+        }
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::WaitIdle()
+    {
+        std::vector<std::shared_future<void>> compiling;
+
+        {
+            std::lock_guard lock(mMutex);
+
+            for (const auto& [hash, entry] : mEntries)
+            {
+                if (entry.Compiled.valid())
+                {
+                    compiling.push_back(entry.Compiled);
+                }
+            }
+        }
+
+        for (const auto& compiled : compiling)
+        {
+            compiled.wait();
+        }
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::Reset()
+    {
+        WaitIdle();
+
+        std::lock_guard lock(mMutex);
+
+        mEntries.clear();
+        mFallback = 0;
+        mStatistics = {};
+    }
+
+    template <typename T>
+    PipelineCompileState PipelineStateCache<T>::GetState(const Pipeline& pipeline) const
+    {
+        std::lock_guard lock(mMutex);
+
+        auto found = mEntries.find(pipeline.GetHash());
+
+        return found == mEntries.end() ? PipelineCompileState::Missing : found->second.State;
+    }
+
+    template <typename T>
+    PipelineCacheStatistics PipelineStateCache<T>::GetStatistics() const
+    {
+        std::lock_guard lock(mMutex);
+
+        return mStatistics;
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::Compile(std::shared_ptr<const PipelineSnapshot> pipeline, Entry& entry)
+    {
+        if (not mCompiler)
+        {
+            Console::LogWarning("Pipeline {:016x} requested without a compiler", pipeline->Hash);
+
+            entry.State = PipelineCompileState::Failed;
+
+            return;
+        }
+
+        entry.State = PipelineCompileState::Compiling;
+
+        const Types::UI64 hash = pipeline->Hash;
+
+        auto compile = [compiler = mCompiler, snapshot = std::move(pipeline)]() -> std::optional<T>
+        {
+            try
+            {
+                return compiler(snapshot->Descriptor);
+            }
+            catch (...)
+            {
+                return std::nullopt;
+            }
+        };
+
+        Threading::ThreadPool& pool = Threading::ThreadPool::GetShared();
+
+        if (pool.GetWorkerCount() == 0)
+        {
+            Store(hash, compile());
+
+            return;
+        }
+
+        auto store = [this, compile = std::move(compile), hash]
+        {
+            std::optional<T> object = compile();
+
+            std::lock_guard lock(mMutex);
+
+            Store(hash, std::move(object));
+        };
+
+        entry.Compiled = pool.Submit(std::move(store)).share();
+    }
+
+    template <typename T>
+    void PipelineStateCache<T>::Store(Types::UI64 hash, std::optional<T>&& object)
+    {
+        Entry& compiled = mEntries[hash];
+
+        if (not object)
+        {
+            Console::LogWarning("Failed to compile pipeline {:016x}", hash);
+
+            compiled.State = PipelineCompileState::Failed;
+
+            mStatistics.Failed++;
+
+            return;
+        }
+
+        compiled.Object = std::move(*object);
+        compiled.State = PipelineCompileState::Ready;
+
+        mStatistics.Compiled++;
+    }
+
+    template <typename T>
+    const T* PipelineStateCache<T>::Find(Types::UI64 hash) const
+    {
+        auto found = mEntries.find(hash);
+
+        if (found == mEntries.end() or found->second.State != PipelineCompileState::Ready)
+        {
+            return nullptr;
+        }
+
+        return &found->second.Object;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "rendering/vulkan/commands.hpp"
+
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+
+namespace Mosaic::Internal::Rendering
+{
+    template <typename Function>
+    void VulkanCommandSystem::RecordParallel(vk::CommandBuffer primary, Types::UI32 frame, const vk::RenderPassBeginInfo& renderPassBeginInfo, Types::UI64 count, Types::UI64 grainSize, Function&& function)
+    {
+        const Types::UI64 threadCount = std::max(GetThreadCount(), 1u);
+
+        grainSize = std::max<Types::UI64>({grainSize, 1, (count + threadCount - 1) / threadCount});
+
+        std::vector<vk::CommandBuffer> secondaries((count + grainSize - 1) / grainSize);
+
+        vk::CommandBufferInheritanceInfo inheritanceInfo{renderPassBeginInfo.renderPass, 0, renderPassBeginInfo.framebuffer};
+        vk::CommandBufferBeginInfo beginInfo{vk::CommandBufferUsageFlagBits::eOneTimeSubmit | vk::CommandBufferUsageFlagBits::eRenderPassContinue, &inheritanceInfo};
+
+        auto record = [&](Types::UI64 first, Types::UI64 last)
+        {
+            const Types::UI64 chunk = first / grainSize;
+
+            vk::CommandBuffer secondary = AcquireSecondary(frame, chunk);
+
+            secondary.begin(beginInfo);
+
+            function(secondary, first, last);
+
+            secondary.end();
+
+            secondaries[chunk] = secondary;
+        };
+
+        Threading::ThreadPool::GetShared().ParallelFor(count, grainSize, record);
+
+        std::erase(secondaries, vk::CommandBuffer{});
+
+        primary.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eSecondaryCommandBuffers);
+
+        if (not secondaries.empty())
+        {
+            primary.executeCommands(secondaries);
+        }
+
+        primary.endRenderPass();
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "utilities/hash.hpp"
+
+#include <type_traits>
+
+namespace Mosaic::Internal::Hashing
+{
+    constexpr Types::UI64 FNV1a(std::span<const std::byte> data, Types::UI64 seed)
+    {
+        Types::UI64 hash = seed;
+
+        for (std::byte byte : data)
+        {
+            hash ^= static_cast<Types::UI64>(byte);
+            hash *= FNV1aPrime;
+        }
+
+        return hash;
+    }
+
+    constexpr Types::UI64 FNV1a(std::string_view data, Types::UI64 seed)
+    {
+        Types::UI64 hash = seed;
+
+        for (char character : data)
+        {
+            hash ^= static_cast<Types::UI64>(static_cast<unsigned char>(character));
+            hash *= FNV1aPrime;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    Types::UI64 FNV1a(const T& value, Types::UI64 seed)
+    {
+        static_assert(std::has_unique_object_representations_v<T> or std::is_floating_point_v<T>, "Only types without padding can be hashed bytewise");
+
+        return FNV1a(std::as_bytes(std::span(&value, 1)), seed);
+    }
+
+    constexpr Types::UI64 Combine(Types::UI64 seed, Types::UI64 value)
+    {
+        return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+    }
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "utilities/kernels.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Mosaic::Internal::Kernels
+{
+    template <TypeConcepts::Numeric T>
+    Types::UI64 Vec3Lanes<T>::Size() const
+    {
+        if (X.size() != Y.size() or X.size() != Z.size())
+        {
+            Console::Throw("Vec3 lanes have mismatched lengths ({}, {}, {})", X.size(), Y.size(), Z.size());
+        }
+
+        return X.size();
+    }
+
+    template <TypeConcepts::Numeric T>
+    Vec3Lanes<T> Vec3Lanes<T>::Subspan(Types::UI64 offset) const
+    {
+        return {X.subspan(offset), Y.subspan(offset), Z.subspan(offset)};
+    }
+
+    template <TypeConcepts::Numeric T>
+    ConstVec3Lanes<T>::ConstVec3Lanes(std::span<const T> x, std::span<const T> y, std::span<const T> z)
+        : X(x), Y(y), Z(z)
+    {
+    }
+
+    template <TypeConcepts::Numeric T>
+    ConstVec3Lanes<T>::ConstVec3Lanes(const Vec3Lanes<T>& lanes)
+        : X(lanes.X), Y(lanes.Y), Z(lanes.Z)
+    {
+    }
+
+    template <TypeConcepts::Numeric T>
+    Types::UI64 ConstVec3Lanes<T>::Size() const
+    {
+        if (X.size() != Y.size() or X.size() != Z.size())
+        {
+            Console::Throw("Vec3 lanes have mismatched lengths ({}, {}, {})", X.size(), Y.size(), Z.size());
+        }
+
+        return X.size();
+    }
+
+    template <TypeConcepts::Numeric T>
+    ConstVec3Lanes<T> ConstVec3Lanes<T>::Subspan(Types::UI64 offset) const
+    {
+        return {X.subspan(offset), Y.subspan(offset), Z.subspan(offset)};
+    }
+}
+
+namespace Mosaic::Internal::Kernels::Detail
+{
+    template <typename... Sizes>
+    void ValidateLaneCounts(Types::UI64 expected, Sizes... sizes)
+    {
+        if (((sizes != expected) or ...))
+        {
+            Console::Throw("Kernel inputs and outputs have mismatched lane counts");
+        }
+    }
+
+    template <TypeConcepts::Numeric T>
+    void TransformScalar(const AffineTransform<T>& transform, ConstVec3Lanes<T> input, Vec3Lanes<T> output)
+    {
+        const auto& m = transform.Elements;
+
+        for (Types::UI64 index = 0; index < input.X.size(); index++)
+        {
+            const T x = input.X[index];
+            const T y = input.Y[index];
+            const T z = input.Z[index];
+
+            output.X[index] = m[0] * x + m[1] * y + m[2] * z + m[3];
+            output.Y[index] = m[4] * x + m[5] * y + m[6] * z + m[7];
+            output.Z[index] = m[8] * x + m[9] * y + m[10] * z + m[11];
+        }
+    }
+
+    template <TypeConcepts::Numeric T>
+    void IntegrateVelocityScalar(Vec3Lanes<T> positions, ConstVec3Lanes<T> velocities, T deltaTime)
+    {
+        for (Types::UI64 index = 0; index < positions.X.size(); index++)
+        {
+            positions.X[index] += velocities.X[index] * deltaTime;
+            positions.Y[index] += velocities.Y[index] * deltaTime;
+            positions.Z[index] += velocities.Z[index] * deltaTime;
+        }
+    }
+
+    template <TypeConcepts::Numeric T>
+    Bounds<T> ComputeBoundsScalar(ConstVec3Lanes<T> points, Bounds<T> bounds)
+    {
+        for (Types::UI64 index = 0; index < points.X.size(); index++)
+        {
+            bounds.Min.X = std::min(bounds.Min.X, points.X[index]);
+            bounds.Min.Y = std::min(bounds.Min.Y, points.Y[index]);
+            bounds.Min.Z = std::min(bounds.Min.Z, points.Z[index]);
+
+            bounds.Max.X = std::max(bounds.Max.X, points.X[index]);
+            bounds.Max.Y = std::max(bounds.Max.Y, points.Y[index]);
+            bounds.Max.Z = std::max(bounds.Max.Z, points.Z[index]);
+        }
+
+        return bounds;
+    }
+
+    template <TypeConcepts::Numeric T>
+    Bounds<T> EmptyBounds()
+    {
+        constexpr T highest = std::numeric_limits<T>::max();
+        constexpr T lowest = std::numeric_limits<T>::lowest();
+
+        return {{highest, highest, highest}, {lowest, lowest, lowest}};
+    }
+
+    template <TypeConcepts::Numeric T>
+    void DistanceSquaredScalar(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, std::span<T> output)
+    {
+        for (Types::UI64 index = 0; index < points.X.size(); index++)
+        {
+            const T dx = points.X[index] - origin.X;
+            const T dy = points.Y[index] - origin.Y;
+            const T dz = points.Z[index] - origin.Z;
+
+            output[index] = dx * dx + dy * dy + dz * dz;
+        }
+    }
+
+    template <TypeConcepts::Numeric T>
+    Types::UI64 WithinDistanceScalar(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, T radius, std::span<Types::UI8> mask)
+    {
+        const T radiusSquared = radius * radius;
+
+        Types::UI64 count = 0;
+
+        for (Types::UI64 index = 0; index < points.X.size(); index++)
+        {
+            const T dx = points.X[index] - origin.X;
+            const T dy = points.Y[index] - origin.Y;
+            const T dz = points.Z[index] - origin.Z;
+
+            const bool inside = dx * dx + dy * dy + dz * dz <= radiusSquared;
+
+            mask[index] = inside;
+            count += inside;
+        }
+
+        return count;
+    }
+}
+
+namespace Mosaic::Internal::Kernels
+{
+    template <TypeConcepts::Numeric T>
+    void Transform(const AffineTransform<T>& transform, ConstVec3Lanes<T> input, Vec3Lanes<T> output)
+    {
+        Detail::ValidateLaneCounts(input.Size(), output.Size());
+
+        Detail::TransformScalar(transform, input, output);
+    }
+
+    template <TypeConcepts::Numeric T>
+    void IntegrateVelocity(Vec3Lanes<T> positions, ConstVec3Lanes<T> velocities, T deltaTime)
+    {
+        Detail::ValidateLaneCounts(positions.Size(), velocities.Size());
+
+        Detail::IntegrateVelocityScalar(positions, velocities, deltaTime);
+    }
+
+    template <TypeConcepts::Numeric T>
+    Bounds<T> ComputeBounds(ConstVec3Lanes<T> points)
+    {
+        points.Size();
+
+        return Detail::ComputeBoundsScalar(points, Detail::EmptyBounds<T>());
+    }
+
+    template <TypeConcepts::Numeric T>
+    void DistanceSquared(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, std::span<T> output)
+    {
+        Detail::ValidateLaneCounts(points.Size(), output.size());
+
+        Detail::DistanceSquaredScalar(points, origin, output);
+    }
+
+    template <TypeConcepts::Numeric T>
+    Types::UI64 WithinDistance(ConstVec3Lanes<T> points, const Types::Vec3<T>& origin, T radius, std::span<Types::UI8> mask)
+    {
+        Detail::ValidateLaneCounts(points.Size(), mask.size());
+
+        return Detail::WithinDistanceScalar(points, origin, radius, mask);
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "utilities/memory.hpp"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Mosaic::Internal::Memory
+{
+    template <typename T, typename... Args>
+    T* LinearAllocator::Create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Linear allocations are released without running destructors");
+
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+}
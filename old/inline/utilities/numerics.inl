@@ -0,0 +1,285 @@
+#pragma once
+
+#include "utilities/numerics.hpp"
+
+#include <bit>
+
+namespace Mosaic::Internal::Types::Detail
+{
+    constexpr F32 RoundNearestEven(F32 value)
+    {
+        constexpr F32 magic = 8388608.0f;
+
+        return value >= 0.0f ? (value + magic) - magic : (value - magic) + magic;
+    }
+
+    constexpr F32 ClampUnsigned(F32 value)
+    {
+        return value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+    }
+
+    constexpr F32 ClampSigned(F32 value)
+    {
+        return value > -1.0f ? (value < 1.0f ? value : 1.0f) : (value <= -1.0f ? -1.0f : 0.0f);
+    }
+
+    constexpr UI16 FloatToHalfBits(F32 value)
+    {
+        constexpr UI32 infinity = 255u << 23;
+        constexpr UI32 halfMaximum = (127u + 16u) << 23;
+        constexpr UI32 denormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        constexpr UI32 normalMinimum = 113u << 23;
+
+        UI32 bits = std::bit_cast<UI32>(value);
+
+        const UI32 sign = bits & 0x80000000u;
+
+        bits ^= sign;
+
+        UI32 result = 0;
+
+        if (bits >= halfMaximum)
+        {
+            result = bits > infinity ? 0x7E00u : 0x7C00u;
+        }
+        else if (bits < normalMinimum)
+        {
+            const F32 shifted = std::bit_cast<F32>(bits) + std::bit_cast<F32>(denormalMagic);
+
+            result = std::bit_cast<UI32>(shifted) - denormalMagic;
+        }
+        else
+        {
+            const UI32 mantissaOdd = (bits >> 13) & 1u;
+
+            bits -= (127u - 15u) << 23;
+            bits += 0xFFFu + mantissaOdd;
+
+            result = bits >> 13;
+        }
+
+        return static_cast<UI16>(result | (sign >> 16));
+    }
+
+    constexpr F32 HalfBitsToFloat(UI16 half)
+    {
+        constexpr UI32 shiftedExponent = 0x7C00u << 13;
+        constexpr F32 magic = std::bit_cast<F32>(113u << 23);
+
+        UI32 bits = (half & 0x7FFFu) << 13;
+
+        const UI32 exponent = shiftedExponent & bits;
+
+        bits += (127u - 15u) << 23;
+
+        if (exponent == shiftedExponent)
+        {
+            bits += (128u - 16u) << 23;
+        }
+        else if (exponent == 0)
+        {
+            bits += 1u << 23;
+            bits = std::bit_cast<UI32>(std::bit_cast<F32>(bits) - magic);
+        }
+
+        return std::bit_cast<F32>(bits | (static_cast<UI32>(half & 0x8000u) << 16));
+    }
+
+    constexpr UI32 PackUnsignedField(F32 value, UI32 maximum)
+    {
+        return static_cast<UI32>(RoundNearestEven(ClampUnsigned(value) * static_cast<F32>(maximum)));
+    }
+
+    constexpr UI32 PackSignedField(F32 value, UI32 maximum, UI32 mask)
+    {
+        return static_cast<UI32>(static_cast<I32>(RoundNearestEven(ClampSigned(value) * static_cast<F32>(maximum)))) & mask;
+    }
+
+    constexpr F32 UnpackSignedField(UI32 bits, UI32 width, UI32 maximum)
+    {
+        const I32 shift = 32 - static_cast<I32>(width);
+        const I32 value = static_cast<I32>(bits << shift) >> shift;
+        const F32 result = static_cast<F32>(value) / static_cast<F32>(maximum);
+
+        return result < -1.0f ? -1.0f : result;
+    }
+}
+
+namespace Mosaic::Internal::Types
+{
+    constexpr F16::F16()
+        : Bits(0)
+    {
+    }
+
+    constexpr F16::F16(F32 value)
+        : Bits(Detail::FloatToHalfBits(value))
+    {
+    }
+
+    constexpr F16::operator F32() const
+    {
+        return Detail::HalfBitsToFloat(Bits);
+    }
+
+    constexpr F16 F16::FromBits(UI16 bits)
+    {
+        F16 result;
+
+        result.Bits = bits;
+
+        return result;
+    }
+
+    template <typename T>
+    constexpr UNorm<T>::UNorm()
+        : Value(0)
+    {
+    }
+
+    template <typename T>
+    constexpr UNorm<T>::UNorm(F32 value)
+        : Value(static_cast<T>(Detail::RoundNearestEven(Detail::ClampUnsigned(value) * static_cast<F32>(Maximum))))
+    {
+    }
+
+    template <typename T>
+    constexpr UNorm<T>::operator F32() const
+    {
+        return static_cast<F32>(Value) / static_cast<F32>(Maximum);
+    }
+
+    template <typename T>
+    constexpr SNorm<T>::SNorm()
+        : Value(0)
+    {
+    }
+
+    template <typename T>
+    constexpr SNorm<T>::SNorm(F32 value)
+        : Value(static_cast<T>(Detail::RoundNearestEven(Detail::ClampSigned(value) * static_cast<F32>(Maximum))))
+    {
+    }
+
+    template <typename T>
+    constexpr SNorm<T>::operator F32() const
+    {
+        const F32 result = static_cast<F32>(Value) / static_cast<F32>(Maximum);
+
+        return result < -1.0f ? -1.0f : result;
+    }
+
+    constexpr UNorm1010102::UNorm1010102()
+        : Bits(0)
+    {
+    }
+
+    constexpr UNorm1010102::UNorm1010102(F32 x, F32 y, F32 z, F32 w)
+        : Bits(Detail::PackUnsignedField(x, 1023) | Detail::PackUnsignedField(y, 1023) << 10 | Detail::PackUnsignedField(z, 1023) << 20 | Detail::PackUnsignedField(w, 3) << 30)
+    {
+    }
+
+    constexpr F32 UNorm1010102::Get(UI32 component) const
+    {
+        if (component == 3)
+        {
+            return static_cast<F32>(Bits >> 30) / 3.0f;
+        }
+
+        return static_cast<F32>((Bits >> (component * 10)) & 0x3FFu) / 1023.0f;
+    }
+
+    constexpr SNorm1010102::SNorm1010102()
+        : Bits(0)
+    {
+    }
+
+    constexpr SNorm1010102::SNorm1010102(F32 x, F32 y, F32 z, F32 w)
+        : Bits(Detail::PackSignedField(x, 511, 0x3FF) | Detail::PackSignedField(y, 511, 0x3FF) << 10 | Detail::PackSignedField(z, 511, 0x3FF) << 20 | Detail::PackSignedField(w, 1, 0x3) << 30)
+    {
+    }
+
+    constexpr F32 SNorm1010102::Get(UI32 component) const
+    {
+        if (component == 3)
+        {
+            return Detail::UnpackSignedField(Bits >> 30, 2, 1);
+        }
+
+        return Detail::UnpackSignedField((Bits >> (component * 10)) & 0x3FFu, 10, 511);
+    }
+}
+
+namespace std
+{
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::min() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x0400u);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::max() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x7BFFu);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::lowest() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0xFBFFu);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::epsilon() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x1400u);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::infinity() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x7C00u);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::quiet_NaN() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x7E00u);
+    }
+
+    constexpr Mosaic::Internal::Types::F16 numeric_limits<Mosaic::Internal::Types::F16>::denorm_min() noexcept
+    {
+        return Mosaic::Internal::Types::F16::FromBits(0x0001u);
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::UNorm<T> numeric_limits<Mosaic::Internal::Types::UNorm<T>>::min() noexcept
+    {
+        return lowest();
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::UNorm<T> numeric_limits<Mosaic::Internal::Types::UNorm<T>>::max() noexcept
+    {
+        return Mosaic::Internal::Types::UNorm<T>(1.0f);
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::UNorm<T> numeric_limits<Mosaic::Internal::Types::UNorm<T>>::lowest() noexcept
+    {
+        return Mosaic::Internal::Types::UNorm<T>(0.0f);
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::SNorm<T> numeric_limits<Mosaic::Internal::Types::SNorm<T>>::min() noexcept
+    {
+        return lowest();
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::SNorm<T> numeric_limits<Mosaic::Internal::Types::SNorm<T>>::max() noexcept
+    {
+        return Mosaic::Internal::Types::SNorm<T>(1.0f);
+    }
+
+    template <typename T>
+    constexpr Mosaic::Internal::Types::SNorm<T> numeric_limits<Mosaic::Internal::Types::SNorm<T>>::lowest() noexcept
+    {
+        return Mosaic::Internal::Types::SNorm<T>(-1.0f);
+    }
+}
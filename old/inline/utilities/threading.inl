@@ -0,0 +1,165 @@
+#pragma once
+
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace Mosaic::Internal::Threading
+{
+    template <typename Function>
+    std::future<std::invoke_result_t<Function>> ThreadPool::Submit(Function&& function)
+    {
+        using Result = std::invoke_result_t<Function>;
+
+        std::packaged_task<Result()> task(std::forward<Function>(function));
+
+        auto future = task.get_future();
+
+        Enqueue([task = std::move(task)]() mutable
+                { task(); });
+
+        return future;
+    }
+
+    template <typename Function>
+    void ThreadPool::ParallelFor(Types::UI64 count, Types::UI64 grainSize, Function&& function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        grainSize = std::max<Types::UI64>(grainSize, 1);
+
+        const Types::UI64 chunkCount = (count + grainSize - 1) / grainSize;
+
+        if (chunkCount == 1 or mWorkers.empty())
+        {
+            function(Types::UI64(0), count);
+
+            return;
+        }
+
+        struct SharedState
+        {
+            std::atomic<Types::UI64> NextChunk = 0;
+            std::atomic<Types::UI64> CompletedChunks = 0;
+
+            std::mutex Mutex;
+            std::condition_variable Finished;
+            std::exception_ptr Error;
+        };
+
+        auto state = std::make_shared<SharedState>();
+
+        auto run = [state, count, grainSize, chunkCount, &function]()
+        {
+            Types::UI64 chunk;
+
+            while ((chunk = state->NextChunk.fetch_add(1)) < chunkCount)
+            {
+                const Types::UI64 first = chunk * grainSize;
+                const Types::UI64 last = std::min(first + grainSize, count);
+
+                try
+                {
+                    function(first, last);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(state->Mutex);
+
+                    if (not state->Error)
+                    {
+                        state->Error = std::current_exception();
+                    }
+                }
+
+                if (state->CompletedChunks.fetch_add(1) + 1 == chunkCount)
+                {
+                    std::lock_guard lock(state->Mutex);
+
+                    state->Finished.notify_all();
+                }
+            }
+        };
+
+        const Types::UI64 helperCount = std::min<Types::UI64>(chunkCount - 1, mWorkers.size());
+
+        for (Types::UI64 helper = 0; helper < helperCount; helper++)
+        {
+            Enqueue(run);
+        }
+
+        run();
+
+        std::unique_lock lock(state->Mutex);
+
+        state->Finished.wait(lock, [&]
+                             { return state->CompletedChunks.load() == chunkCount; });
+
+        if (state->Error)
+        {
+            std::rethrow_exception(state->Error);
+        }
+    }
+
+    template <typename T, Types::UI32 Count>
+    T& BufferedExchange<T, Count>::BeginWrite()
+    {
+        std::unique_lock lock(mMutex);
+
+        mCondition.wait(lock, [this]
+                        { return mOccupied < Count; });
+
+        return mSlots[mWriteIndex];
+    }
+
+    template <typename T, Types::UI32 Count>
+    void BufferedExchange<T, Count>::EndWrite()
+    {
+        {
+            std::lock_guard lock(mMutex);
+
+            mWriteIndex = (mWriteIndex + 1) % Count;
+
+            mReadable++;
+            mOccupied++;
+        }
+
+        mCondition.notify_all();
+    }
+
+    template <typename T, Types::UI32 Count>
+    T* BufferedExchange<T, Count>::BeginRead(std::stop_token stop)
+    {
+        std::unique_lock lock(mMutex);
+
+        if (not mCondition.wait(lock, stop, [this]
+                                { return mReadable > 0; }))
+        {
+            return nullptr;
+        }
+
+        mReadable--;
+
+        return &mSlots[mReadIndex];
+    }
+
+    template <typename T, Types::UI32 Count>
+    void BufferedExchange<T, Count>::EndRead()
+    {
+        {
+            std::lock_guard lock(mMutex);
+
+            mReadIndex = (mReadIndex + 1) % Count;
+
+            mOccupied--;
+        }
+
+        mCondition.notify_all();
+    }
+}
@@ -39,6 +39,7 @@ namespace Mosaic::Internal
                 mRenderer.Update();
             }
 
+            mRenderer.Stop();
             mComponentManager.Stop();
 
             return 0;
@@ -12,14 +12,17 @@
 namespace Mosaic::Internal::Windowing
 {
     Window::Window(Rendering::Renderer& renderer, EventManager& eventManager)
-        : mSize(0, 0), mPosition(0, 0), mTitle(""), mConfigPath(""), mRunning(false), mFullscreen(false), mRenderer(renderer), mEventManager(eventManager)
+        : mSize(0, 0), mPosition(0, 0), mTitle(""), mConfigPath(""), mRunning(false), mFullscreen(false), mHandle(nullptr), mRenderer(renderer), mEventManager(eventManager)
     {
-        Initialise();
     }
 
     Window::~Window()
     {
-        SDL_DestroyWindow(mHandle);
+        if (mHandle)
+        {
+            SDL_DestroyWindow(mHandle);
+        }
+
         SDL_Quit();
     }
 
@@ -30,7 +33,10 @@ namespace Mosaic::Internal::Windowing
 
     void Window::Create()
     {
-        CreateWindow();
+        if (mRenderer.mAPI != Rendering::RendererAPI::Null)
+        {
+            CreateWindow();
+        }
 
         mRunning = true;
     }
@@ -60,6 +66,11 @@ namespace Mosaic::Internal::Windowing
 
     void Window::Initialise()
     {
+        if (mRenderer.mAPI == Rendering::RendererAPI::Null)
+        {
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        }
+
         if (not SDL_Init(SDL_INIT_VIDEO))
         {
             Console::Throw("Failed to initialise windowing system");
@@ -84,6 +95,10 @@ namespace Mosaic::Internal::Windowing
 
                 break;
             }
+            case (Rendering::RendererAPI::Null):
+            {
+                break;
+            }
         }
 
         if (mResizable)
@@ -0,0 +1,556 @@
+#include "rendering/capture.hpp"
+#include "rendering/mesh.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+namespace Mosaic::Internal::Rendering
+{
+    void CommandCapture::Begin(const std::string& path, Types::UI32 frameCount)
+    {
+        if (IsCapturing())
+        {
+            Console::LogWarning("Command capture to {} is already in progress", mPath);
+
+            return;
+        }
+
+        *this = {};
+
+        mPath = path;
+        mRemainingFrames = frameCount;
+
+        mFrameOffsets.push_back(0);
+    }
+
+    void CommandCapture::End()
+    {
+        if (mPath.empty())
+        {
+            return;
+        }
+
+        CaptureFileHeader header = {};
+
+        header.Magic = Magic;
+        header.Version = Version;
+        header.FrameCount = mFrameOffsets.size() - 1;
+        header.MeshCount = mMeshData.size();
+        header.PipelineCount = mPipelineData.size();
+        header.ShaderCount = mShaderData.size();
+        header.BufferCount = mBuffers.size();
+        header.RenderPassCount = mRenderPasses.size();
+
+        std::vector<std::byte> buffer(sizeof(CaptureFileHeader));
+
+        header.Frames = MeshFile::AppendSection(buffer, mFrameOffsets.data(), mFrameOffsets.size() * sizeof(Types::UI64));
+        header.Commands = MeshFile::AppendSection(buffer, mCommands.data(), mCommands.size() * sizeof(CapturedCommand));
+
+        std::vector<MeshFileSection> meshes;
+
+        for (const auto& mesh : mMeshData)
+        {
+            meshes.push_back(MeshFile::AppendSection(buffer, mesh.data(), mesh.size()));
+        }
+
+        header.Meshes = MeshFile::AppendSection(buffer, meshes.data(), meshes.size() * sizeof(MeshFileSection));
+
+        std::vector<CapturedShader> shaders;
+
+        for (const Shader& shader : mShaderData)
+        {
+            const std::span<const Types::UI32> code = shader.GetCode();
+            const std::string& entryPoint = shader.GetEntryPoint();
+
+            shaders.push_back({
+                .Stage = static_cast<Types::UI32>(shader.GetStage()),
+                .Reserved = 0,
+                .Code = MeshFile::AppendSection(buffer, code.data(), code.size_bytes()),
+                .EntryPoint = MeshFile::AppendSection(buffer, entryPoint.data(), entryPoint.size()),
+            });
+        }
+
+        header.Shaders = MeshFile::AppendSection(buffer, shaders.data(), shaders.size() * sizeof(CapturedShader));
+
+        std::vector<CapturedPipeline> pipelines;
+
+        for (const PipelineSnapshot& pipeline : mPipelineData)
+        {
+            const PipelineDescriptor& descriptor = pipeline.Descriptor;
+
+            std::vector<Types::UI32> shaderIndices;
+
+            for (const Shader* shader : descriptor.Shaders)
+            {
+                shaderIndices.push_back(shader ? mShaders.at(shader->GetHash()) : NullShader);
+            }
+
+            const std::vector<MeshFileAttribute> attributes = descriptor.Format ? MeshFile::SerialiseFormat(*descriptor.Format) : std::vector<MeshFileAttribute>();
+
+            pipelines.push_back({
+                .Topology = static_cast<Types::UI32>(descriptor.Topology),
+                .Cull = static_cast<Types::UI32>(descriptor.Cull),
+                .Blend = static_cast<Types::UI32>(descriptor.Blend),
+                .DepthTest = descriptor.Depth.Test,
+                .DepthWrite = descriptor.Depth.Write,
+                .DepthCompare = static_cast<Types::UI32>(descriptor.Depth.Compare),
+                .DepthFormat = descriptor.DepthFormat,
+                .SampleCount = descriptor.SampleCount,
+                .Layout = descriptor.Format ? static_cast<Types::UI32>(descriptor.Format->GetLayoutDescriptor().Layout) : 0,
+                .Reserved = 0,
+                .Shaders = MeshFile::AppendSection(buffer, shaderIndices.data(), shaderIndices.size() * sizeof(Types::UI32)),
+                .Attributes = MeshFile::AppendSection(buffer, attributes.data(), attributes.size() * sizeof(MeshFileAttribute)),
+                .ColourFormats = MeshFile::AppendSection(buffer, descriptor.ColourFormats.data(), descriptor.ColourFormats.size() * sizeof(Types::UI32)),
+            });
+        }
+
+        header.Pipelines = MeshFile::AppendSection(buffer, pipelines.data(), pipelines.size() * sizeof(CapturedPipeline));
+
+        header.FileSize = buffer.size();
+
+        std::memcpy(buffer.data(), &header, sizeof(CaptureFileHeader));
+
+        const std::string temporaryPath = mPath + ".tmp";
+
+        {
+            std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+            if (not out)
+            {
+                Console::Throw("Failed to write command capture: {}", temporaryPath);
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, mPath);
+
+        Console::LogNotice("Captured {} frames ({} commands, {} meshes, {} pipelines) to {}", header.FrameCount, mCommands.size(), mMeshData.size(), mPipelineData.size(), mPath);
+
+        *this = {};
+    }
+
+    bool CommandCapture::IsCapturing() const
+    {
+        return mRemainingFrames > 0;
+    }
+
+    void CommandCapture::RecordFrame(std::span<const RendererCommandEntry> entries)
+    {
+        if (not IsCapturing())
+        {
+            return;
+        }
+
+        mFrameMeshes.clear();
+
+        for (const RendererCommandEntry& entry : entries)
+        {
+            CapturedCommand captured = Capture(*entry.Command);
+
+            captured.Key = entry.Key;
+
+            mCommands.push_back(captured);
+        }
+
+        mFrameOffsets.push_back(mCommands.size());
+
+        if (--mRemainingFrames == 0)
+        {
+            End();
+        }
+    }
+
+    CapturedCommand CommandCapture::Capture(const RendererCommandWrapper& command)
+    {
+        CapturedCommand captured = {};
+
+        auto capture = [&]<typename T>(const T& command)
+        {
+            if constexpr (std::is_same_v<T, VSyncStateGetCommand>)
+            {
+                captured.Type = CapturedCommandType::VSyncGet;
+            }
+            else if constexpr (std::is_same_v<T, VSyncStateSetCommand>)
+            {
+                captured.Type = CapturedCommandType::VSyncSet;
+                captured.Payload[0] = static_cast<Types::UI32>(command.Request);
+            }
+            else if constexpr (std::is_same_v<T, SwapColourGetCommand>)
+            {
+                captured.Type = CapturedCommandType::SwapColourGet;
+            }
+            else if constexpr (std::is_same_v<T, SwapColourSetCommand>)
+            {
+                captured.Type = CapturedCommandType::SwapColourSet;
+                captured.Payload = {std::bit_cast<Types::UI32>(command.Request.X), std::bit_cast<Types::UI32>(command.Request.Y), std::bit_cast<Types::UI32>(command.Request.Z), std::bit_cast<Types::UI32>(command.Request.W)};
+            }
+            else if constexpr (std::is_same_v<T, RenderPassCommand>)
+            {
+                captured.Type = CapturedCommandType::RenderPass;
+                captured.Object = Register(&command.mPass, mRenderPasses);
+            }
+            else if constexpr (std::is_same_v<T, BufferInteractCommand>)
+            {
+                captured.Type = CapturedCommandType::Buffer;
+                captured.Object = Register(&command.mBuffer, mBuffers);
+            }
+            else if constexpr (std::is_same_v<T, ShaderInteractCommand>)
+            {
+                captured.Type = CapturedCommandType::Shader;
+                captured.Object = RegisterShader(command.mShader);
+            }
+            else if constexpr (std::is_same_v<T, PipelineInteractCommand>)
+            {
+                captured.Type = CapturedCommandType::Pipeline;
+                captured.Object = RegisterPipeline(command.mPipeline);
+            }
+            else if constexpr (std::is_same_v<T, DrawCommand>)
+            {
+                captured.Type = CapturedCommandType::Draw;
+                captured.Object = RegisterMesh(command.mMesh);
+                captured.Payload[0] = command.mInstanceCount;
+            }
+        };
+
+        std::visit(capture, command);
+
+        return captured;
+    }
+
+    Types::UI32 CommandCapture::RegisterMesh(const Mesh& mesh)
+    {
+        auto [frameMesh, firstDraw] = mFrameMeshes.try_emplace(mesh.GetID(), 0);
+
+        if (not firstDraw)
+        {
+            return frameMesh->second;
+        }
+
+        auto [found, inserted] = mMeshes.try_emplace(HashMeshContent(mesh), mMeshData.size());
+
+        if (inserted)
+        {
+            mMeshData.push_back(MeshFile::Serialise(mesh, mPath));
+        }
+
+        frameMesh->second = found->second;
+
+        return found->second;
+    }
+
+    Types::UI32 CommandCapture::RegisterShader(const Shader& shader)
+    {
+        auto [found, inserted] = mShaders.try_emplace(shader.GetHash(), mShaderData.size());
+
+        if (inserted)
+        {
+            mShaderData.push_back(shader);
+        }
+
+        return found->second;
+    }
+
+    Types::UI32 CommandCapture::RegisterPipeline(const Pipeline& pipeline)
+    {
+        auto [found, inserted] = mPipelines.try_emplace(pipeline.GetHash(), mPipelineData.size());
+
+        if (not inserted)
+        {
+            return found->second;
+        }
+
+        const PipelineSnapshot& snapshot = mPipelineData.emplace_back(pipeline.GetDescriptor());
+
+        for (const Shader* shader : snapshot.Descriptor.Shaders)
+        {
+            if (shader)
+            {
+                RegisterShader(*shader);
+            }
+        }
+
+        return found->second;
+    }
+
+    Types::UI64 CommandCapture::HashMeshContent(const Mesh& mesh)
+    {
+        Types::UI64 hash = Hashing::FNV1a(mesh.GetIndexData());
+
+        for (Types::UI32 stream = 0; stream < mesh.GetStreamCount(); stream++)
+        {
+            hash = Hashing::Combine(hash, Hashing::FNV1a(mesh.GetStreamData(stream)));
+        }
+
+        hash = Hashing::Combine(hash, mesh.GetVertexCount());
+        hash = Hashing::Combine(hash, static_cast<Types::UI64>(mesh.GetIndexType()));
+
+        return hash;
+    }
+
+    Types::UI32 CommandCapture::Register(const void* object, std::unordered_map<const void*, Types::UI32>& objects)
+    {
+        return objects.try_emplace(object, objects.size()).first->second;
+    }
+
+    void CommandReplay::Load(const std::string& path)
+    {
+        auto mapping = std::make_shared<Files::MappedFile>(path);
+
+        const auto file = mapping->GetData();
+
+        if (file.size() < sizeof(CaptureFileHeader))
+        {
+            Console::Throw("Command capture is truncated: {}", path);
+        }
+
+        CaptureFileHeader header;
+
+        std::memcpy(&header, file.data(), sizeof(CaptureFileHeader));
+
+        if (header.Magic != CommandCapture::Magic or header.Version != CommandCapture::Version)
+        {
+            Console::Throw("Command capture has an unsupported signature or version {}: {}", header.Version, path);
+        }
+
+        if (header.FileSize != file.size())
+        {
+            Console::Throw("Command capture size {} does not match its header {}: {}", file.size(), header.FileSize, path);
+        }
+
+        mFrameOffsets = MeshFile::GetSection<Types::UI64>(file, header.Frames);
+        mCommands = MeshFile::GetSection<CapturedCommand>(file, header.Commands);
+
+        if (mFrameOffsets.size() != Types::UI64(header.FrameCount) + 1 or mFrameOffsets.front() != 0 or mFrameOffsets.back() != mCommands.size() or not std::ranges::is_sorted(mFrameOffsets))
+        {
+            Console::Throw("Command capture frame table is malformed: {}", path);
+        }
+
+        const auto meshes = MeshFile::GetSection<MeshFileSection>(file, header.Meshes);
+
+        if (meshes.size() != header.MeshCount)
+        {
+            Console::Throw("Command capture mesh table is malformed: {}", path);
+        }
+
+        mMeshes.clear();
+
+        for (const MeshFileSection& section : meshes)
+        {
+            auto& mesh = mMeshes.emplace_back(std::make_unique<Mesh>());
+
+            MeshFile::Load(mapping, MeshFile::GetSection<std::byte>(file, section), *mesh, path);
+        }
+
+        LoadShaders(file, header, path);
+        LoadPipelines(file, header, path);
+
+        mBuffers = std::vector<Buffer>(header.BufferCount);
+
+        for (const CapturedCommand& command : mCommands)
+        {
+            const Types::UI64 limit = [&]() -> Types::UI64
+            {
+                switch (command.Type)
+                {
+                    case (CapturedCommandType::Buffer):
+                    {
+                        return mBuffers.size();
+                    }
+                    case (CapturedCommandType::Shader):
+                    {
+                        return mShaders.size();
+                    }
+                    case (CapturedCommandType::Pipeline):
+                    {
+                        return mPipelines.size();
+                    }
+                    case (CapturedCommandType::Draw):
+                    {
+                        return mMeshes.size();
+                    }
+                    default:
+                    {
+                        return ~0ull;
+                    }
+                }
+            }();
+
+            if (command.Object >= limit or command.Type > CapturedCommandType::Draw)
+            {
+                Console::Throw("Command capture references an unknown object: {}", path);
+            }
+        }
+
+        mMapping = std::move(mapping);
+        mSkippedCommands = 0;
+    }
+
+    void CommandReplay::LoadShaders(std::span<const std::byte> file, const CaptureFileHeader& header, const std::string& path)
+    {
+        const auto shaders = MeshFile::GetSection<CapturedShader>(file, header.Shaders);
+
+        if (shaders.size() != header.ShaderCount)
+        {
+            Console::Throw("Command capture shader table is malformed: {}", path);
+        }
+
+        mShaders.clear();
+
+        for (const CapturedShader& shader : shaders)
+        {
+            if (shader.Stage > static_cast<Types::UI32>(ShaderStage::Compute))
+            {
+                Console::Throw("Command capture shader has an unknown stage {}: {}", shader.Stage, path);
+            }
+
+            const auto code = MeshFile::GetSection<Types::UI32>(file, shader.Code);
+            const auto entryPoint = MeshFile::GetSection<char>(file, shader.EntryPoint);
+
+            mShaders.emplace_back(static_cast<ShaderStage>(shader.Stage), std::vector<Types::UI32>(code.begin(), code.end()), std::string(entryPoint.begin(), entryPoint.end()));
+        }
+    }
+
+    void CommandReplay::LoadPipelines(std::span<const std::byte> file, const CaptureFileHeader& header, const std::string& path)
+    {
+        const auto pipelines = MeshFile::GetSection<CapturedPipeline>(file, header.Pipelines);
+
+        if (pipelines.size() != header.PipelineCount)
+        {
+            Console::Throw("Command capture pipeline table is malformed: {}", path);
+        }
+
+        mPipelines.clear();
+        mFormats.clear();
+
+        for (const CapturedPipeline& pipeline : pipelines)
+        {
+            if (pipeline.Topology > static_cast<Types::UI32>(PrimitiveTopology::TriangleStrip) or pipeline.Cull > static_cast<Types::UI32>(CullMode::Back) or pipeline.Blend > static_cast<Types::UI32>(BlendMode::Additive) or pipeline.DepthCompare > static_cast<Types::UI32>(CompareOperation::Always))
+            {
+                Console::Throw("Command capture pipeline has an unknown state: {}", path);
+            }
+
+            PipelineDescriptor descriptor;
+
+            for (Types::UI32 shader : MeshFile::GetSection<Types::UI32>(file, pipeline.Shaders))
+            {
+                if (shader != CommandCapture::NullShader and shader >= mShaders.size())
+                {
+                    Console::Throw("Command capture pipeline references an unknown shader {}: {}", shader, path);
+                }
+
+                descriptor.Shaders.push_back(shader == CommandCapture::NullShader ? nullptr : &mShaders[shader]);
+            }
+
+            const auto attributes = MeshFile::GetSection<MeshFileAttribute>(file, pipeline.Attributes);
+
+            if (not attributes.empty())
+            {
+                descriptor.Format = mFormats.emplace_back(MeshFile::LoadFormat(pipeline.Layout, attributes, path)).get();
+            }
+
+            const auto colourFormats = MeshFile::GetSection<Types::UI32>(file, pipeline.ColourFormats);
+
+            descriptor.Topology = static_cast<PrimitiveTopology>(pipeline.Topology);
+            descriptor.Cull = static_cast<CullMode>(pipeline.Cull);
+            descriptor.Blend = static_cast<BlendMode>(pipeline.Blend);
+            descriptor.Depth = {pipeline.DepthTest != 0, pipeline.DepthWrite != 0, static_cast<CompareOperation>(pipeline.DepthCompare)};
+            descriptor.ColourFormats.assign(colourFormats.begin(), colourFormats.end());
+            descriptor.DepthFormat = pipeline.DepthFormat;
+            descriptor.SampleCount = pipeline.SampleCount;
+
+            mPipelines.emplace_back(descriptor);
+        }
+    }
+
+    Types::UI32 CommandReplay::GetFrameCount() const
+    {
+        return mFrameOffsets.empty() ? 0 : mFrameOffsets.size() - 1;
+    }
+
+    Types::UI64 CommandReplay::GetSkippedCommands() const
+    {
+        return mSkippedCommands;
+    }
+
+    void CommandReplay::Submit(Types::UI32 frame, RendererCommandManager& manager)
+    {
+        if (frame >= GetFrameCount())
+        {
+            Console::LogWarning("Replay frame {} is out of range, capture has {} frames", frame, GetFrameCount());
+
+            return;
+        }
+
+        for (const CapturedCommand& command : mCommands.subspan(mFrameOffsets[frame], mFrameOffsets[frame + 1] - mFrameOffsets[frame]))
+        {
+            switch (command.Type)
+            {
+                case (CapturedCommandType::VSyncGet):
+                {
+                    manager.Submit(VSyncStateGetCommand(mVSyncWriteback), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::VSyncSet):
+                {
+                    manager.Submit(VSyncStateSetCommand(static_cast<RendererVSync>(command.Payload[0])), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::SwapColourGet):
+                {
+                    manager.Submit(SwapColourGetCommand(mSwapColourWriteback), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::SwapColourSet):
+                {
+                    const Types::Vec4<Types::F32> colour(std::bit_cast<Types::F32>(command.Payload[0]), std::bit_cast<Types::F32>(command.Payload[1]), std::bit_cast<Types::F32>(command.Payload[2]), std::bit_cast<Types::F32>(command.Payload[3]));
+
+                    manager.Submit(SwapColourSetCommand(colour), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::RenderPass):
+                {
+                    mSkippedCommands++;
+
+                    break;
+                }
+                case (CapturedCommandType::Buffer):
+                {
+                    manager.Submit(BufferInteractCommand(mBuffers[command.Object]), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::Shader):
+                {
+                    manager.Submit(ShaderInteractCommand(mShaders[command.Object]), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::Pipeline):
+                {
+                    manager.Submit(PipelineInteractCommand(mPipelines[command.Object]), command.Key);
+
+                    break;
+                }
+                case (CapturedCommandType::Draw):
+                {
+                    manager.Submit(DrawCommand(*mMeshes[command.Object], command.Payload[0]), command.Key);
+
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -1,24 +1,427 @@
+#include "rendering/capture.hpp"
 #include "rendering/commands.hpp"
+#include "rendering/renderer.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace Mosaic::Internal::Rendering::Detail
+{
+    template <typename Entry>
+    void RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch)
+    {
+        scratch.resize(entries.size());
+
+        for (Types::UI32 shift = 0; shift < 64; shift += 8)
+        {
+            std::array<Types::UI64, 256> offsets = {};
+
+            for (const Entry& entry : entries)
+            {
+                offsets[(entry.Key >> shift) & 0xFF]++;
+            }
+
+            if (std::ranges::find(offsets, entries.size()) != offsets.end())
+            {
+                continue;
+            }
+
+            Types::UI64 total = 0;
+
+            for (Types::UI64& offset : offsets)
+            {
+                const Types::UI64 count = offset;
+
+                offset = total;
+                total += count;
+            }
+
+            for (const Entry& entry : entries)
+            {
+                scratch[offsets[(entry.Key >> shift) & 0xFF]++] = entry;
+            }
+
+            entries.swap(scratch);
+        }
+    }
+}
 
 namespace Mosaic::Internal::Rendering
 {
+    Types::UI64 CommandSortKey::Encode() const
+    {
+        Types::UI64 key = Layer & ((1ull << LayerBits) - 1);
+
+        key = (key << PassBits) | (Pass & ((1ull << PassBits) - 1));
+        key = (key << PipelineBits) | (Pipeline & ((1ull << PipelineBits) - 1));
+        key = (key << MaterialBits) | (Material & ((1ull << MaterialBits) - 1));
+        key = (key << DepthBits) | (Depth & ((1ull << DepthBits) - 1));
+
+        return key;
+    }
+
+    CommandSortKey CommandSortKey::Decode(Types::UI64 key)
+    {
+        CommandSortKey result;
+
+        result.Depth = key & ((1ull << DepthBits) - 1);
+        key >>= DepthBits;
+
+        result.Material = key & ((1ull << MaterialBits) - 1);
+        key >>= MaterialBits;
+
+        result.Pipeline = key & ((1ull << PipelineBits) - 1);
+        key >>= PipelineBits;
+
+        result.Pass = key & ((1ull << PassBits) - 1);
+        key >>= PassBits;
+
+        result.Layer = key & ((1ull << LayerBits) - 1);
+
+        return result;
+    }
+
+    Types::UI32 CommandSortKey::QuantiseDepth(Types::F32 depth, bool backToFront)
+    {
+        constexpr Types::UI32 maximum = (1u << DepthBits) - 1;
+
+        const Types::UI32 quantised = std::lround(std::clamp(depth, 0.0f, 1.0f) * maximum);
+
+        return backToFront ? maximum - quantised : quantised;
+    }
+
+    VSyncStateGetCommand::RendererCommand(RendererVSync& writeback)
+        : Writeback(writeback)
+    {
+    }
+
+    VSyncStateSetCommand::RendererCommand(RendererVSync request)
+        : Request(request)
+    {
+    }
+
+    SwapColourGetCommand::RendererCommand(Types::Vec4<Types::F32>& writeback)
+        : Writeback(writeback)
+    {
+    }
+
+    SwapColourSetCommand::RendererCommand(Types::Vec4<Types::F32> request)
+        : Request(request)
+    {
+    }
+
+    RenderPassCommand::RendererCommand(RenderPass& pass)
+        : mPass(pass)
+    {
+    }
+
+    BufferInteractCommand::RendererCommand(Buffer& buffer)
+        : mBuffer(buffer)
+    {
+    }
+
+    PipelineInteractCommand::RendererCommand(Pipeline& pipeline)
+        : mPipeline(pipeline)
+    {
+    }
+
+    ShaderInteractCommand::RendererCommand(Shader& shader)
+        : mShader(shader)
+    {
+    }
+
+    DrawCommand::RendererCommand(Mesh& mesh, Types::UI32 instanceCount)
+        : mMesh(mesh), mMeshID(mesh.GetID()), mInstanceCount(instanceCount)
+    {
+    }
+
+    void RendererCommandWriter::Submit(const RendererCommandWrapper& command, Types::UI64 key)
+    {
+        mEntries.push_back({key, mAllocator.Create<RendererCommandWrapper>(command)});
+    }
+
+    void RendererCommandWriter::Submit(const RendererCommandWrapper& command, const CommandSortKey& key)
+    {
+        Submit(command, key.Encode());
+    }
+
+    Types::UI64 RendererCommandWriter::GetCommandCount() const
+    {
+        return mEntries.size();
+    }
+
+    void RendererCommandWriter::BeginChunk(Types::UI64 chunk)
+    {
+        mSegments.push_back({chunk, mEntries.size()});
+    }
+
+    void RendererCommandWriter::Reset()
+    {
+        mEntries.clear();
+        mSegments.clear();
+
+        mAllocator.Reset();
+    }
+
     RendererCommandManager::RendererCommandManager(Renderer& renderer)
-        : mRenderer(renderer)
+        : mCapture(std::make_unique<CommandCapture>()), mRenderer(renderer)
+    {
+    }
+
+    RendererCommandManager::~RendererCommandManager()
     {
+        try
+        {
+            mCapture->End();
+        }
+        catch (const std::exception& error)
+        {
+            Console::LogError("Failed to finish command capture: {}", error.what());
+        }
     }
 
-    void RendererCommandManager::Submit(const RendererCommandWrapper& command)
+    void RendererCommandManager::Submit(const RendererCommandWrapper& command, Types::UI64 key)
     {
-        mCommands.push_back(command);
+        mWriter.Submit(command, key);
+    }
+
+    void RendererCommandManager::Submit(const RendererCommandWrapper& command, const CommandSortKey& key)
+    {
+        mWriter.Submit(command, key);
+    }
+
+    void RendererCommandManager::ReserveWriters(Types::UI32 count)
+    {
+        while (mWriters.size() < count)
+        {
+            mWriters.push_back(std::make_unique<RendererCommandWriter>());
+        }
+    }
+
+    RendererCommandWriter& RendererCommandManager::GetWriter(Types::UI32 index)
+    {
+        if (index >= mWriters.size())
+        {
+            Console::Throw("Command writer {} was not reserved ({} available)", index, mWriters.size());
+
+            throw;
+        }
+
+        return *mWriters[index];
     }
 
     void RendererCommandManager::Send()
     {
-        // TODO: send commands to assigned Renderer
+        mStatistics = {};
+
+        Merge();
+
+        mCapture->RecordFrame(mEntries);
+
+        Sort();
+
+        EliminateRedundantBinds();
+
+        mStatistics.SentCommands = mSortedCommands.size();
+
+        mRenderer.UpdateCommands(mSortedCommands);
+
+        Purge();
+    }
+
+    void RendererCommandManager::BeginCapture(const std::string& path, Types::UI32 frameCount)
+    {
+        mCapture->Begin(path, frameCount);
+    }
+
+    const RendererCommandStatistics& RendererCommandManager::GetStatistics() const
+    {
+        return mStatistics;
+    }
+
+    void RendererCommandManager::Merge()
+    {
+        mEntries.clear();
+
+        struct Chunk
+        {
+            Types::UI64 Index;
+
+            std::span<const RendererCommandEntry> Entries;
+        };
+
+        auto append = [&](std::span<const RendererCommandEntry> entries)
+        {
+            const RendererCommandWrapper* pipeline = nullptr;
+            const RendererCommandWrapper* shader = nullptr;
+            const RendererCommandWrapper* buffer = nullptr;
+
+            for (RendererCommandEntry entry : entries)
+            {
+                const RendererCommandWrapper& command = *entry.Command;
+
+                if (std::holds_alternative<PipelineInteractCommand>(command))
+                {
+                    pipeline = entry.Command;
+                }
+                else if (std::holds_alternative<ShaderInteractCommand>(command))
+                {
+                    shader = entry.Command;
+                }
+                else if (std::holds_alternative<BufferInteractCommand>(command))
+                {
+                    buffer = entry.Command;
+                }
+                else if (std::holds_alternative<DrawCommand>(command))
+                {
+                    entry.Pipeline = pipeline;
+                    entry.Shader = shader;
+                    entry.Buffer = buffer;
+                }
+
+                mEntries.push_back(entry);
+            }
+        };
+
+        std::vector<Chunk> chunks;
+
+        if (not mWriter.mEntries.empty())
+        {
+            append(mWriter.mEntries);
+
+            mStatistics.WriterCount++;
+        }
+
+        for (const auto& writer : mWriters)
+        {
+            const std::span<const RendererCommandEntry> entries = writer->mEntries;
+
+            if (entries.empty())
+            {
+                continue;
+            }
+
+            const Types::UI64 unchunked = writer->mSegments.empty() ? entries.size() : writer->mSegments.front().First;
+
+            append(entries.first(unchunked));
+
+            for (Types::UI64 segment = 0; segment < writer->mSegments.size(); segment++)
+            {
+                const Types::UI64 first = writer->mSegments[segment].First;
+                const Types::UI64 last = segment + 1 < writer->mSegments.size() ? writer->mSegments[segment + 1].First : entries.size();
+
+                chunks.push_back({writer->mSegments[segment].Chunk, entries.subspan(first, last - first)});
+            }
+
+            mStatistics.WriterCount++;
+        }
+
+        std::ranges::sort(chunks, {}, &Chunk::Index);
+
+        for (const Chunk& chunk : chunks)
+        {
+            append(chunk.Entries);
+        }
+
+        mStatistics.SubmittedCommands = mEntries.size();
+    }
+
+    void RendererCommandManager::Sort()
+    {
+        Detail::RadixSort(mEntries, mScratch);
+    }
+
+    void RendererCommandManager::EliminateRedundantBinds()
+    {
+        const Pipeline* boundPipeline = nullptr;
+        const Shader* boundShader = nullptr;
+        const Buffer* boundBuffer = nullptr;
+
+        auto redundant = [&]<typename T>(const T& command)
+        {
+            if constexpr (std::is_same_v<T, PipelineInteractCommand>)
+            {
+                return std::exchange(boundPipeline, &command.mPipeline) == &command.mPipeline;
+            }
+            else if constexpr (std::is_same_v<T, ShaderInteractCommand>)
+            {
+                return std::exchange(boundShader, &command.mShader) == &command.mShader;
+            }
+            else if constexpr (std::is_same_v<T, BufferInteractCommand>)
+            {
+                return std::exchange(boundBuffer, &command.mBuffer) == &command.mBuffer;
+            }
+            else
+            {
+                if constexpr (std::is_same_v<T, RenderPassCommand>)
+                {
+                    boundPipeline = nullptr;
+                    boundShader = nullptr;
+                    boundBuffer = nullptr;
+                }
+
+                return false;
+            }
+        };
+
+        Types::UI64 emittedBinds = 0;
+
+        auto bind = [&](const RendererCommandWrapper* command)
+        {
+            if (not command or std::visit(redundant, *command))
+            {
+                return;
+            }
+
+            mSortedCommands.push_back(*command);
+
+            emittedBinds++;
+        };
+
+        mSortedCommands.clear();
+        mSortedCommands.reserve(mEntries.size());
+
+        for (const RendererCommandEntry& entry : mEntries)
+        {
+            const RendererCommandWrapper& command = *entry.Command;
+
+            if (std::holds_alternative<PipelineInteractCommand>(command) or std::holds_alternative<ShaderInteractCommand>(command) or std::holds_alternative<BufferInteractCommand>(command))
+            {
+                mStatistics.SubmittedBinds++;
+
+                continue;
+            }
+
+            if (std::holds_alternative<DrawCommand>(command))
+            {
+                bind(entry.Pipeline);
+                bind(entry.Shader);
+                bind(entry.Buffer);
+            }
+
+            std::visit(redundant, command);
+
+            mSortedCommands.push_back(command);
+        }
+
+        mStatistics.EliminatedBinds = mStatistics.SubmittedBinds > emittedBinds ? mStatistics.SubmittedBinds - emittedBinds : 0;
     }
 
     void RendererCommandManager::Purge()
     {
-        mCommands.clear();
+        mEntries.clear();
+
+        mWriter.Reset();
+
+        for (const auto& writer : mWriters)
+        {
+            writer->Reset();
+        }
     }
-}
\ No newline at end of file
+}
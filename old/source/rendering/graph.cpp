@@ -0,0 +1,473 @@
+#include "rendering/graph.hpp"
+#include "rendering/commands.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <string_view>
+
+namespace Mosaic::Internal::Rendering
+{
+    Types::UI32 LocalRenderGraph::AddRenderPass(RenderPass& pass)
+    {
+        return AddPass("Pass " + std::to_string(mPasses.size()), &pass);
+    }
+
+    Types::UI32 LocalRenderGraph::AddPass(const std::string& name, RenderPass* pass)
+    {
+        mPasses.push_back({.Name = name, .Pass = pass, .Accesses = {}, .Queue = RenderGraphQueue::Graphics, .SideEffects = false});
+
+        return mPasses.size() - 1;
+    }
+
+    Types::UI32 LocalRenderGraph::CreateResource(const std::string& name, const RenderResourceDescriptor& descriptor)
+    {
+        mResources.push_back({.Name = name, .Descriptor = descriptor, .Imported = false, .Output = false});
+
+        return mResources.size() - 1;
+    }
+
+    Types::UI32 LocalRenderGraph::ImportResource(const std::string& name, const RenderResourceDescriptor& descriptor)
+    {
+        mResources.push_back({.Name = name, .Descriptor = descriptor, .Imported = true, .Output = false});
+
+        return mResources.size() - 1;
+    }
+
+    void LocalRenderGraph::Read(Types::UI32 pass, Types::UI32 resource, RenderResourceUsage usage)
+    {
+        if (IsValidAccess(pass, resource))
+        {
+            mPasses[pass].Accesses.push_back({resource, usage, false});
+        }
+    }
+
+    void LocalRenderGraph::Write(Types::UI32 pass, Types::UI32 resource, RenderResourceUsage usage)
+    {
+        if (IsValidAccess(pass, resource))
+        {
+            mPasses[pass].Accesses.push_back({resource, usage, true});
+        }
+    }
+
+    void LocalRenderGraph::SetMemoryRequirements(Types::UI32 resource, Types::UI64 sizeBytes, Types::UI64 alignment)
+    {
+        if (resource >= mResources.size())
+        {
+            Console::LogWarning("Render graph resource {} does not exist", resource);
+
+            return;
+        }
+
+        mResources[resource].Descriptor.SizeBytes = sizeBytes;
+        mResources[resource].Descriptor.Alignment = alignment;
+    }
+
+    void LocalRenderGraph::MarkOutput(Types::UI32 resource)
+    {
+        if (resource >= mResources.size())
+        {
+            Console::LogWarning("Render graph resource {} does not exist", resource);
+
+            return;
+        }
+
+        mResources[resource].Output = true;
+    }
+
+    void LocalRenderGraph::SetSideEffects(Types::UI32 pass)
+    {
+        if (pass >= mPasses.size())
+        {
+            Console::LogWarning("Render graph pass {} does not exist", pass);
+
+            return;
+        }
+
+        mPasses[pass].SideEffects = true;
+    }
+
+    void LocalRenderGraph::SetQueue(Types::UI32 pass, RenderGraphQueue queue)
+    {
+        if (pass >= mPasses.size())
+        {
+            Console::LogWarning("Render graph pass {} does not exist", pass);
+
+            return;
+        }
+
+        mPasses[pass].Queue = queue;
+    }
+
+    const CompiledRenderGraph& LocalRenderGraph::Compile()
+    {
+        const Types::UI64 hash = HashTopology();
+
+        if (mCompiledValid and mCompiled.Hash == hash)
+        {
+            return mCompiled;
+        }
+
+        mCompiled = {};
+        mCompiled.Hash = hash;
+
+        SortPasses();
+        ComputeLifetimes();
+        AliasResources();
+
+        mCompiledValid = true;
+
+        return mCompiled;
+    }
+
+    void LocalRenderGraph::Send(RendererCommandManager& commands)
+    {
+        const CompiledRenderGraph& compiled = Compile();
+
+        constexpr Types::UI64 maximumPasses = 1ull << CommandSortKey::PassBits;
+
+        if (compiled.Order.size() > maximumPasses)
+        {
+            Console::Throw("Render graph has {} passes but sort keys can order at most {}", compiled.Order.size(), maximumPasses);
+        }
+
+        for (Types::UI32 position = 0; position < compiled.Order.size(); position++)
+        {
+            RenderPass* pass = mPasses[compiled.Order[position]].Pass;
+
+            if (pass)
+            {
+                commands.Submit(RenderPassCommand(*pass), CommandSortKey{.Pass = static_cast<Types::UI8>(position)});
+            }
+        }
+    }
+
+    void LocalRenderGraph::Reset()
+    {
+        mPasses.clear();
+        mResources.clear();
+    }
+
+    const std::vector<RenderGraphPass>& LocalRenderGraph::GetPasses() const
+    {
+        return mPasses;
+    }
+
+    const std::vector<RenderGraphResource>& LocalRenderGraph::GetResources() const
+    {
+        return mResources;
+    }
+
+    bool LocalRenderGraph::SharesMemory(Types::UI32 first, Types::UI32 second) const
+    {
+        if (first == second or first >= mCompiled.Offsets.size() or second >= mCompiled.Offsets.size())
+        {
+            return false;
+        }
+
+        const Types::UI64 firstOffset = mCompiled.Offsets[first];
+        const Types::UI64 secondOffset = mCompiled.Offsets[second];
+
+        if (firstOffset == CompiledRenderGraph::NotAliased or secondOffset == CompiledRenderGraph::NotAliased)
+        {
+            return false;
+        }
+
+        return firstOffset < secondOffset + mResources[second].Descriptor.SizeBytes and secondOffset < firstOffset + mResources[first].Descriptor.SizeBytes;
+    }
+
+    bool LocalRenderGraph::IsValidAccess(Types::UI32 pass, Types::UI32 resource) const
+    {
+        if (pass >= mPasses.size() or resource >= mResources.size())
+        {
+            Console::LogWarning("Render graph access from pass {} to resource {} is out of range", pass, resource);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    Types::UI64 LocalRenderGraph::HashTopology() const
+    {
+        Types::UI64 hash = Hashing::FNV1a(mPasses.size());
+
+        for (const RenderGraphPass& pass : mPasses)
+        {
+            hash = Hashing::Combine(hash, Hashing::FNV1a(std::string_view(pass.Name)));
+            hash = Hashing::Combine(hash, static_cast<Types::UI64>(pass.Queue) << 1 | pass.SideEffects);
+
+            for (const RenderGraphAccess& access : pass.Accesses)
+            {
+                hash = Hashing::Combine(hash, access.Resource);
+                hash = Hashing::Combine(hash, static_cast<Types::UI64>(access.Usage) << 1 | access.Write);
+            }
+        }
+
+        for (const RenderGraphResource& resource : mResources)
+        {
+            const RenderResourceDescriptor& descriptor = resource.Descriptor;
+
+            hash = Hashing::Combine(hash, static_cast<Types::UI64>(descriptor.Type));
+            hash = Hashing::Combine(hash, static_cast<Types::UI64>(descriptor.Width) << 32 | descriptor.Height);
+            hash = Hashing::Combine(hash, descriptor.Format);
+            hash = Hashing::Combine(hash, descriptor.SizeBytes);
+            hash = Hashing::Combine(hash, descriptor.Alignment);
+            hash = Hashing::Combine(hash, resource.Imported << 1 | resource.Output);
+        }
+
+        return hash;
+    }
+
+    void LocalRenderGraph::SortPasses()
+    {
+        const Types::UI32 passCount = mPasses.size();
+        const Types::UI32 none = CompiledRenderGraph::Unused;
+
+        std::vector<std::vector<Types::UI32>> successors(passCount);
+        std::vector<std::vector<Types::UI32>> producers(passCount);
+
+        std::vector<Types::UI32> lastWriter(mResources.size(), none);
+        std::vector<std::vector<Types::UI32>> readers(mResources.size());
+
+        for (Types::UI32 pass = 0; pass < passCount; pass++)
+        {
+            for (const RenderGraphAccess& access : mPasses[pass].Accesses)
+            {
+                if (not access.Write and lastWriter[access.Resource] != none and lastWriter[access.Resource] != pass)
+                {
+                    successors[lastWriter[access.Resource]].push_back(pass);
+                    producers[pass].push_back(lastWriter[access.Resource]);
+                }
+            }
+
+            for (const RenderGraphAccess& access : mPasses[pass].Accesses)
+            {
+                if (not access.Write)
+                {
+                    readers[access.Resource].push_back(pass);
+                }
+            }
+
+            for (const RenderGraphAccess& access : mPasses[pass].Accesses)
+            {
+                if (not access.Write)
+                {
+                    continue;
+                }
+
+                if (lastWriter[access.Resource] != none and lastWriter[access.Resource] != pass)
+                {
+                    successors[lastWriter[access.Resource]].push_back(pass);
+                }
+
+                for (Types::UI32 reader : readers[access.Resource])
+                {
+                    if (reader != pass)
+                    {
+                        successors[reader].push_back(pass);
+                    }
+                }
+
+                lastWriter[access.Resource] = pass;
+
+                readers[access.Resource].clear();
+            }
+        }
+
+        std::vector<bool> live(passCount, false);
+        std::vector<Types::UI32> pending;
+
+        for (Types::UI32 pass = 0; pass < passCount; pass++)
+        {
+            bool root = mPasses[pass].SideEffects;
+
+            for (const RenderGraphAccess& access : mPasses[pass].Accesses)
+            {
+                const RenderGraphResource& resource = mResources[access.Resource];
+
+                root = root or (access.Write and (resource.Imported or resource.Output));
+            }
+
+            if (root)
+            {
+                live[pass] = true;
+
+                pending.push_back(pass);
+            }
+        }
+
+        while (not pending.empty())
+        {
+            const Types::UI32 pass = pending.back();
+
+            pending.pop_back();
+
+            for (Types::UI32 producer : producers[pass])
+            {
+                if (not live[producer])
+                {
+                    live[producer] = true;
+
+                    pending.push_back(producer);
+                }
+            }
+        }
+
+        std::vector<Types::UI32> incoming(passCount, 0);
+
+        for (Types::UI32 pass = 0; pass < passCount; pass++)
+        {
+            if (not live[pass])
+            {
+                continue;
+            }
+
+            std::ranges::sort(successors[pass]);
+
+            const auto [first, last] = std::ranges::unique(successors[pass]);
+
+            successors[pass].erase(first, last);
+
+            for (Types::UI32 successor : successors[pass])
+            {
+                incoming[successor] += live[successor];
+            }
+        }
+
+        std::priority_queue<Types::UI32, std::vector<Types::UI32>, std::greater<>> ready;
+
+        for (Types::UI32 pass = 0; pass < passCount; pass++)
+        {
+            if (live[pass] and incoming[pass] == 0)
+            {
+                ready.push(pass);
+            }
+        }
+
+        while (not ready.empty())
+        {
+            const Types::UI32 pass = ready.top();
+
+            ready.pop();
+
+            mCompiled.Order.push_back(pass);
+
+            for (Types::UI32 successor : successors[pass])
+            {
+                if (live[successor] and --incoming[successor] == 0)
+                {
+                    ready.push(successor);
+                }
+            }
+        }
+
+        mCompiled.Culled.resize(passCount);
+
+        for (Types::UI32 pass = 0; pass < passCount; pass++)
+        {
+            mCompiled.Culled[pass] = not live[pass];
+        }
+    }
+
+    void LocalRenderGraph::ComputeLifetimes()
+    {
+        mCompiled.Lifetimes.assign(mResources.size(), {CompiledRenderGraph::Unused, CompiledRenderGraph::Unused});
+
+        for (Types::UI32 position = 0; position < mCompiled.Order.size(); position++)
+        {
+            for (const RenderGraphAccess& access : mPasses[mCompiled.Order[position]].Accesses)
+            {
+                RenderResourceLifetime& lifetime = mCompiled.Lifetimes[access.Resource];
+
+                if (lifetime.FirstPass == CompiledRenderGraph::Unused)
+                {
+                    lifetime.FirstPass = position;
+                }
+
+                lifetime.LastPass = position;
+            }
+        }
+    }
+
+    void LocalRenderGraph::AliasResources()
+    {
+        struct Placement
+        {
+            Types::UI32 Resource;
+            Types::UI64 Offset;
+        };
+
+        mCompiled.Offsets.assign(mResources.size(), CompiledRenderGraph::NotAliased);
+
+        std::vector<Types::UI32> transients;
+
+        for (Types::UI32 resource = 0; resource < mResources.size(); resource++)
+        {
+            if (mResources[resource].Imported or mCompiled.Lifetimes[resource].FirstPass == CompiledRenderGraph::Unused)
+            {
+                continue;
+            }
+
+            if (mResources[resource].Descriptor.SizeBytes == 0)
+            {
+                Console::LogWarning("Render graph resource \"{}\" has no memory size and will not be aliased", mResources[resource].Name);
+
+                continue;
+            }
+
+            transients.push_back(resource);
+        }
+
+        std::ranges::stable_sort(transients, std::greater<>(), [&](Types::UI32 resource)
+                                 { return mResources[resource].Descriptor.SizeBytes; });
+
+        std::vector<Placement> placed;
+
+        for (Types::UI32 resource : transients)
+        {
+            const RenderResourceDescriptor& descriptor = mResources[resource].Descriptor;
+            const RenderResourceLifetime& lifetime = mCompiled.Lifetimes[resource];
+
+            const Types::UI64 alignment = std::max<Types::UI64>(descriptor.Alignment, 1);
+
+            std::vector<Placement> overlapping;
+
+            for (const Placement& placement : placed)
+            {
+                const RenderResourceLifetime& other = mCompiled.Lifetimes[placement.Resource];
+
+                if (other.FirstPass <= lifetime.LastPass and lifetime.FirstPass <= other.LastPass)
+                {
+                    overlapping.push_back(placement);
+                }
+            }
+
+            std::ranges::sort(overlapping, {}, &Placement::Offset);
+
+            Types::UI64 offset = 0;
+
+            for (const Placement& placement : overlapping)
+            {
+                const Types::UI64 end = placement.Offset + mResources[placement.Resource].Descriptor.SizeBytes;
+
+                if (offset + descriptor.SizeBytes <= placement.Offset)
+                {
+                    break;
+                }
+
+                offset = std::max(offset, (end + alignment - 1) / alignment * alignment);
+            }
+
+            placed.push_back({resource, offset});
+
+            mCompiled.Offsets[resource] = offset;
+            mCompiled.TransientBytes = std::max(mCompiled.TransientBytes, offset + descriptor.SizeBytes);
+            mCompiled.UnaliasedBytes += descriptor.SizeBytes;
+        }
+    }
+}
@@ -0,0 +1,1052 @@
+#include "rendering/importer.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/hash.hpp"
+#include "utilities/mappedfile.hpp"
+#include "utilities/memory.hpp"
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+#include <optional>
+
+namespace Mosaic::Internal::Rendering::Detail
+{
+    inline constexpr Types::UI32 MissingOBJIndex = ~0u;
+
+    struct OBJBlock
+    {
+        Types::UI64 First;
+        Types::UI64 Last;
+
+        Types::UI64 PositionCount = 0;
+        Types::UI64 TexcoordCount = 0;
+        Types::UI64 NormalCount = 0;
+        Types::UI64 TriangleCount = 0;
+
+        Types::UI64 PositionBase = 0;
+        Types::UI64 TexcoordBase = 0;
+        Types::UI64 NormalBase = 0;
+        Types::UI64 TriangleBase = 0;
+    };
+
+    struct OBJCorner
+    {
+        Types::UI32 Position;
+        Types::UI32 Texcoord;
+        Types::UI32 Normal;
+
+        bool operator==(const OBJCorner& other) const = default;
+    };
+
+    struct OBJTotals
+    {
+        Types::UI64 Positions;
+        Types::UI64 Texcoords;
+        Types::UI64 Normals;
+    };
+
+    std::vector<OBJBlock> SplitOBJBlocks(std::string_view text, Types::UI64 blockSize)
+    {
+        std::vector<OBJBlock> blocks;
+
+        Types::UI64 first = 0;
+
+        while (first < text.size())
+        {
+            Types::UI64 last = std::min<Types::UI64>(first + blockSize, text.size());
+
+            if (last < text.size())
+            {
+                const Types::UI64 newline = text.find('\n', last);
+
+                last = newline == std::string_view::npos ? text.size() : newline + 1;
+            }
+
+            blocks.push_back({.First = first, .Last = last});
+
+            first = last;
+        }
+
+        return blocks;
+    }
+
+    bool NextLine(std::string_view text, Types::UI64& cursor, Types::UI64 last, std::string_view& outLine)
+    {
+        if (cursor >= last)
+        {
+            return false;
+        }
+
+        Types::UI64 end = text.find('\n', cursor);
+
+        end = end == std::string_view::npos or end > last ? last : end;
+
+        outLine = text.substr(cursor, end - cursor);
+
+        if (not outLine.empty() and outLine.back() == '\r')
+        {
+            outLine.remove_suffix(1);
+        }
+
+        cursor = end + 1;
+
+        return true;
+    }
+
+    std::string_view NextToken(std::string_view& line)
+    {
+        const Types::UI64 start = line.find_first_not_of(" \t");
+
+        if (start == std::string_view::npos)
+        {
+            line = {};
+
+            return {};
+        }
+
+        const Types::UI64 end = std::min(line.find_first_of(" \t", start), line.size());
+
+        const std::string_view token = line.substr(start, end - start);
+
+        line.remove_prefix(end);
+
+        return token;
+    }
+
+    Types::F32 ParseOBJFloat(std::string_view token)
+    {
+        Types::F32 value = 0.0f;
+
+        if (not token.empty() and token.front() == '+')
+        {
+            token.remove_prefix(1);
+        }
+
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+
+        if (error != std::errc())
+        {
+            Console::Throw("Malformed OBJ number: {}", std::string(token));
+        }
+
+        return value;
+    }
+
+    Types::UI32 ResolveOBJIndex(std::string_view token, Types::UI64 localCount, Types::UI64 totalCount)
+    {
+        if (token.empty())
+        {
+            return MissingOBJIndex;
+        }
+
+        Types::I64 index = 0;
+
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), index);
+
+        if (error != std::errc() or index == 0)
+        {
+            Console::Throw("Malformed OBJ face index: {}", std::string(token));
+        }
+
+        const Types::I64 resolved = index > 0 ? index - 1 : static_cast<Types::I64>(localCount) + index;
+
+        if (resolved < 0 or static_cast<Types::UI64>(resolved) >= totalCount)
+        {
+            Console::Throw("OBJ face index {} is out of range", index);
+        }
+
+        return static_cast<Types::UI32>(resolved);
+    }
+
+    OBJCorner ParseOBJCorner(std::string_view token, const OBJBlock& block, const OBJTotals& totals, Types::UI64 positions, Types::UI64 texcoords, Types::UI64 normals)
+    {
+        const Types::UI64 firstSlash = token.find('/');
+        const Types::UI64 secondSlash = firstSlash == std::string_view::npos ? std::string_view::npos : token.find('/', firstSlash + 1);
+
+        const std::string_view position = token.substr(0, firstSlash);
+        const std::string_view texcoord = firstSlash == std::string_view::npos ? std::string_view() : token.substr(firstSlash + 1, secondSlash - firstSlash - 1);
+        const std::string_view normal = secondSlash == std::string_view::npos ? std::string_view() : token.substr(secondSlash + 1);
+
+        return {
+            .Position = ResolveOBJIndex(position, block.PositionBase + positions, totals.Positions),
+            .Texcoord = ResolveOBJIndex(texcoord, block.TexcoordBase + texcoords, totals.Texcoords),
+            .Normal = ResolveOBJIndex(normal, block.NormalBase + normals, totals.Normals),
+        };
+    }
+
+    void CountOBJBlock(std::string_view text, OBJBlock& block)
+    {
+        Types::UI64 cursor = block.First;
+
+        std::string_view line;
+
+        while (NextLine(text, cursor, block.Last, line))
+        {
+            const std::string_view keyword = NextToken(line);
+
+            if (keyword == "v")
+            {
+                block.PositionCount++;
+            }
+            else if (keyword == "vt")
+            {
+                block.TexcoordCount++;
+            }
+            else if (keyword == "vn")
+            {
+                block.NormalCount++;
+            }
+            else if (keyword == "f")
+            {
+                Types::UI64 corners = 0;
+
+                while (not NextToken(line).empty())
+                {
+                    corners++;
+                }
+
+                block.TriangleCount += corners >= 3 ? corners - 2 : 0;
+            }
+        }
+    }
+
+    void ParseOBJBlock(std::string_view text, const OBJBlock& block, const OBJTotals& totals, std::span<Types::F32> positions, std::span<Types::F32> texcoords, std::span<Types::F32> normals, std::span<OBJCorner> corners)
+    {
+        Types::UI64 cursor = block.First;
+
+        Types::UI64 positionCount = 0;
+        Types::UI64 texcoordCount = 0;
+        Types::UI64 normalCount = 0;
+        Types::UI64 triangleCount = 0;
+
+        std::string_view line;
+
+        while (NextLine(text, cursor, block.Last, line))
+        {
+            const std::string_view keyword = NextToken(line);
+
+            if (keyword == "v")
+            {
+                Types::F32* position = &positions[(block.PositionBase + positionCount++) * 3];
+
+                for (Types::UI32 axis = 0; axis < 3; axis++)
+                {
+                    position[axis] = ParseOBJFloat(NextToken(line));
+                }
+            }
+            else if (keyword == "vt")
+            {
+                Types::F32* texcoord = &texcoords[(block.TexcoordBase + texcoordCount++) * 2];
+
+                texcoord[0] = ParseOBJFloat(NextToken(line));
+
+                const std::string_view v = NextToken(line);
+
+                texcoord[1] = v.empty() ? 0.0f : ParseOBJFloat(v);
+            }
+            else if (keyword == "vn")
+            {
+                Types::F32* normal = &normals[(block.NormalBase + normalCount++) * 3];
+
+                for (Types::UI32 axis = 0; axis < 3; axis++)
+                {
+                    normal[axis] = ParseOBJFloat(NextToken(line));
+                }
+            }
+            else if (keyword == "f")
+            {
+                OBJCorner first = {};
+                OBJCorner previous = {};
+
+                Types::UI32 cornerIndex = 0;
+
+                for (std::string_view token = NextToken(line); not token.empty(); token = NextToken(line))
+                {
+                    const OBJCorner corner = ParseOBJCorner(token, block, totals, positionCount, texcoordCount, normalCount);
+
+                    if (cornerIndex == 0)
+                    {
+                        first = corner;
+                    }
+                    else if (cornerIndex >= 2)
+                    {
+                        OBJCorner* triangle = &corners[(block.TriangleBase + triangleCount++) * 3];
+
+                        triangle[0] = first;
+                        triangle[1] = previous;
+                        triangle[2] = corner;
+                    }
+
+                    previous = corner;
+
+                    cornerIndex++;
+                }
+            }
+        }
+    }
+
+    Types::UI64 WeldOBJCorners(std::span<const OBJCorner> corners, std::vector<OBJCorner>& outVertices, std::vector<Types::UI32>& outIndices)
+    {
+        Types::UI64 tableSize = 1;
+
+        while (tableSize < corners.size() * 2)
+        {
+            tableSize <<= 1;
+        }
+
+        std::vector<Types::UI32> table(tableSize, MissingOBJIndex);
+
+        outVertices.clear();
+        outIndices.resize(corners.size());
+
+        for (Types::UI64 corner = 0; corner < corners.size(); corner++)
+        {
+            Types::UI64 slot = Hashing::FNV1a(corners[corner]) & (tableSize - 1);
+
+            while (table[slot] != MissingOBJIndex and not (outVertices[table[slot]] == corners[corner]))
+            {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            if (table[slot] == MissingOBJIndex)
+            {
+                table[slot] = outVertices.size();
+
+                outVertices.push_back(corners[corner]);
+            }
+
+            outIndices[corner] = table[slot];
+        }
+
+        return outVertices.size();
+    }
+
+    std::optional<VertexAttributeType> GetGLTFAttributeType(Types::UI32 componentType, bool normalized)
+    {
+        switch (componentType)
+        {
+            case (5120):
+            {
+                return normalized ? VertexAttributeType::SNorm8 : VertexAttributeType::I8;
+            }
+            case (5121):
+            {
+                return normalized ? VertexAttributeType::UNorm8 : VertexAttributeType::UI8;
+            }
+            case (5122):
+            {
+                return normalized ? VertexAttributeType::SNorm16 : VertexAttributeType::I16;
+            }
+            case (5123):
+            {
+                return normalized ? VertexAttributeType::UNorm16 : VertexAttributeType::UI16;
+            }
+            case (5125):
+            {
+                return normalized ? std::nullopt : std::optional(VertexAttributeType::UI32);
+            }
+            case (5126):
+            {
+                return VertexAttributeType::F32;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    Types::UI32 GetGLTFComponentSize(Types::UI32 componentType)
+    {
+        switch (componentType)
+        {
+            case (5120):
+            case (5121):
+            {
+                return 1;
+            }
+            case (5122):
+            case (5123):
+            {
+                return 2;
+            }
+            case (5125):
+            case (5126):
+            {
+                return 4;
+            }
+        }
+
+        return 0;
+    }
+
+    Types::UI32 GetGLTFComponentCount(const std::string& type)
+    {
+        if (type == "SCALAR")
+        {
+            return 1;
+        }
+
+        if (type == "VEC2")
+        {
+            return 2;
+        }
+
+        if (type == "VEC3")
+        {
+            return 3;
+        }
+
+        if (type == "VEC4")
+        {
+            return 4;
+        }
+
+        return 0;
+    }
+
+    Types::UI32 GetGLTFAttributeRank(const std::string& name)
+    {
+        constexpr std::string_view order[] = {"POSITION", "NORMAL", "TANGENT", "TEXCOORD_", "COLOR_", "JOINTS_", "WEIGHTS_"};
+
+        for (Types::UI32 rank = 0; rank < std::size(order); rank++)
+        {
+            if (name.starts_with(order[rank]))
+            {
+                return rank;
+            }
+        }
+
+        return std::size(order);
+    }
+
+    std::vector<std::byte> DecodeBase64(std::string_view text)
+    {
+        auto decode = [](char character) -> Types::I32
+        {
+            if (character >= 'A' and character <= 'Z')
+            {
+                return character - 'A';
+            }
+
+            if (character >= 'a' and character <= 'z')
+            {
+                return character - 'a' + 26;
+            }
+
+            if (character >= '0' and character <= '9')
+            {
+                return character - '0' + 52;
+            }
+
+            if (character == '+' or character == '-')
+            {
+                return 62;
+            }
+
+            if (character == '/' or character == '_')
+            {
+                return 63;
+            }
+
+            return -1;
+        };
+
+        std::vector<std::byte> output;
+
+        output.reserve(text.size() * 3 / 4);
+
+        Types::UI32 accumulator = 0;
+        Types::UI32 bits = 0;
+
+        for (char character : text)
+        {
+            const Types::I32 value = decode(character);
+
+            if (value < 0)
+            {
+                continue;
+            }
+
+            accumulator = (accumulator << 6) | value;
+            bits += 6;
+
+            if (bits >= 8)
+            {
+                bits -= 8;
+
+                output.push_back(static_cast<std::byte>((accumulator >> bits) & 0xFF));
+            }
+        }
+
+        return output;
+    }
+
+    std::string DecodeURI(std::string_view uri)
+    {
+        std::string output;
+
+        for (Types::UI64 i = 0; i < uri.size(); i++)
+        {
+            Types::UI32 value = 0;
+
+            if (uri[i] == '%' and i + 2 < uri.size() and std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3)
+            {
+                output.push_back(static_cast<char>(value));
+
+                i += 2;
+            }
+            else
+            {
+                output.push_back(uri[i]);
+            }
+        }
+
+        return output;
+    }
+}
+
+namespace Mosaic::Internal::Rendering
+{
+    std::vector<ImportedMesh> MeshImporter::Import(const std::string& path)
+    {
+        std::string extension = std::filesystem::path(path).extension().string();
+
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char character)
+                       { return static_cast<char>(std::tolower(static_cast<unsigned char>(character))); });
+
+        if (extension == ".obj")
+        {
+            return ImportOBJ(path);
+        }
+
+        if (extension == ".gltf" or extension == ".glb")
+        {
+            return ImportGLTF(path);
+        }
+
+        Console::LogWarning("Unsupported mesh file extension: {}", extension);
+
+        return {};
+    }
+
+    std::vector<ImportedMesh> MeshImporter::ImportOBJ(const std::string& path)
+    {
+        Files::MappedFile file(path);
+
+        const auto bytes = file.GetData();
+
+        const std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+        auto& pool = Threading::ThreadPool::GetShared();
+
+        std::vector<Detail::OBJBlock> blocks = Detail::SplitOBJBlocks(text, OBJBlockSize);
+
+        auto countBlocks = [&](Types::UI64 first, Types::UI64 last)
+        {
+            for (Types::UI64 block = first; block < last; block++)
+            {
+                Detail::CountOBJBlock(text, blocks[block]);
+            }
+        };
+
+        pool.ParallelFor(blocks.size(), 1, countBlocks);
+
+        Detail::OBJTotals totals = {};
+
+        Types::UI64 triangleCount = 0;
+
+        for (auto& block : blocks)
+        {
+            block.PositionBase = totals.Positions;
+            block.TexcoordBase = totals.Texcoords;
+            block.NormalBase = totals.Normals;
+            block.TriangleBase = triangleCount;
+
+            totals.Positions += block.PositionCount;
+            totals.Texcoords += block.TexcoordCount;
+            totals.Normals += block.NormalCount;
+
+            triangleCount += block.TriangleCount;
+        }
+
+        if (triangleCount == 0)
+        {
+            Console::LogWarning("OBJ file contains no faces: {}", path);
+
+            return {};
+        }
+
+        std::vector<Types::F32> positions(totals.Positions * 3);
+        std::vector<Types::F32> texcoords(totals.Texcoords * 2);
+        std::vector<Types::F32> normals(totals.Normals * 3);
+        std::vector<Detail::OBJCorner> corners(triangleCount * 3);
+
+        auto parseBlocks = [&](Types::UI64 first, Types::UI64 last)
+        {
+            for (Types::UI64 block = first; block < last; block++)
+            {
+                Detail::ParseOBJBlock(text, blocks[block], totals, positions, texcoords, normals, corners);
+            }
+        };
+
+        pool.ParallelFor(blocks.size(), 1, parseBlocks);
+
+        std::vector<Detail::OBJCorner> vertices;
+        std::vector<Types::UI32> indices;
+
+        const Types::UI64 vertexCount = Detail::WeldOBJCorners(corners, vertices, indices);
+
+        const bool hasTexcoords = std::any_of(vertices.begin(), vertices.end(), [](const Detail::OBJCorner& corner)
+                                              { return corner.Texcoord != Detail::MissingOBJIndex; });
+
+        const bool hasNormals = std::any_of(vertices.begin(), vertices.end(), [](const Detail::OBJCorner& corner)
+                                            { return corner.Normal != Detail::MissingOBJIndex; });
+
+        auto format = std::make_shared<VertexFormat>();
+
+        format->AddAttribute(VertexAttribute<Types::Vec3<Types::F32>>(1));
+
+        if (hasTexcoords)
+        {
+            format->AddAttribute(VertexAttribute<Types::Vec2<Types::F32>>(1));
+        }
+
+        if (hasNormals)
+        {
+            format->AddAttribute(VertexAttribute<Types::Vec3<Types::F32>>(1));
+        }
+
+        std::vector<ImportedMesh> meshes(1);
+
+        ImportedMesh& imported = meshes.front();
+
+        imported.Name = std::filesystem::path(path).stem().string();
+
+        Mesh& mesh = imported.Data;
+
+        mesh.SetVertexFormat(format);
+        mesh.AllocateStreams(vertexCount);
+
+        const auto& layout = format->GetLayoutDescriptor();
+
+        const Types::UI64 stride = layout.Streams[0].StrideBytes;
+
+        std::byte* destination = mesh.mStreams[0].data();
+
+        auto writeVertices = [&](Types::UI64 first, Types::UI64 last)
+        {
+            for (Types::UI64 vertex = first; vertex < last; vertex++)
+            {
+                const Detail::OBJCorner& corner = vertices[vertex];
+
+                std::byte* output = destination + vertex * stride;
+
+                std::memcpy(output, &positions[corner.Position * 3], 3 * sizeof(Types::F32));
+
+                output += 3 * sizeof(Types::F32);
+
+                if (hasTexcoords)
+                {
+                    const Types::F32 zero[2] = {};
+
+                    std::memcpy(output, corner.Texcoord == Detail::MissingOBJIndex ? zero : &texcoords[corner.Texcoord * 2], 2 * sizeof(Types::F32));
+
+                    output += 2 * sizeof(Types::F32);
+                }
+
+                if (hasNormals)
+                {
+                    const Types::F32 zero[3] = {};
+
+                    std::memcpy(output, corner.Normal == Detail::MissingOBJIndex ? zero : &normals[corner.Normal * 3], 3 * sizeof(Types::F32));
+                }
+            }
+        };
+
+        pool.ParallelFor(vertexCount, OBJBlockSize / stride, writeVertices);
+
+        mesh.RefreshViews();
+        mesh.SetIndexData(indices);
+
+        return meshes;
+    }
+
+    std::vector<ImportedMesh> MeshImporter::ImportGLTF(const std::string& path)
+    {
+        Files::MappedFile file(path);
+
+        const auto bytes = file.GetData();
+
+        std::string_view json;
+        std::span<const std::byte> binary;
+
+        constexpr Types::UI32 GLBMagic = 0x46546C67;
+        constexpr Types::UI32 GLBJsonChunk = 0x4E4F534A;
+        constexpr Types::UI32 GLBBinaryChunk = 0x004E4942;
+
+        Types::UI32 magic = 0;
+
+        if (bytes.size() >= sizeof(magic))
+        {
+            std::memcpy(&magic, bytes.data(), sizeof(magic));
+        }
+
+        if (magic == GLBMagic)
+        {
+            Types::UI32 header[3];
+
+            if (bytes.size() < sizeof(header))
+            {
+                Console::Throw("GLB file is truncated: {}", path);
+            }
+
+            std::memcpy(header, bytes.data(), sizeof(header));
+
+            if (header[1] != 2 or header[2] > bytes.size())
+            {
+                Console::Throw("GLB file has an unsupported version or invalid length: {}", path);
+            }
+
+            Types::UI64 offset = sizeof(header);
+
+            while (offset + 8 <= header[2])
+            {
+                Types::UI32 chunk[2];
+
+                std::memcpy(chunk, bytes.data() + offset, sizeof(chunk));
+
+                offset += sizeof(chunk);
+
+                if (offset + chunk[0] > header[2])
+                {
+                    Console::Throw("GLB chunk exceeds file length: {}", path);
+                }
+
+                if (chunk[1] == GLBJsonChunk and json.empty())
+                {
+                    json = std::string_view(reinterpret_cast<const char*>(bytes.data() + offset), chunk[0]);
+                }
+                else if (chunk[1] == GLBBinaryChunk and binary.empty())
+                {
+                    binary = bytes.subspan(offset, chunk[0]);
+                }
+
+                offset += (chunk[0] + 3) & ~3u;
+            }
+        }
+        else
+        {
+            json = std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+
+        const Files::JsonValue document = Files::JsonValue::Parse(json);
+
+        const auto& bufferEntries = document["buffers"].AsArray();
+
+        std::vector<Files::MappedFile> externalFiles;
+        std::vector<std::vector<std::byte>> embeddedBuffers;
+        std::vector<std::span<const std::byte>> buffers;
+
+        externalFiles.reserve(bufferEntries.size());
+        embeddedBuffers.reserve(bufferEntries.size());
+
+        const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+
+        for (const auto& entry : bufferEntries)
+        {
+            const std::string& uri = entry["uri"].AsString();
+
+            const Types::UI64 byteLength = entry["byteLength"].AsUnsigned();
+
+            std::span<const std::byte> data;
+
+            if (uri.empty())
+            {
+                data = binary;
+            }
+            else if (uri.starts_with("data:"))
+            {
+                const Types::UI64 marker = uri.find(";base64,");
+
+                if (marker == std::string::npos)
+                {
+                    Console::Throw("Only base64 data URIs are supported in glTF buffers: {}", path);
+                }
+
+                data = embeddedBuffers.emplace_back(Detail::DecodeBase64(std::string_view(uri).substr(marker + 8)));
+            }
+            else
+            {
+                data = externalFiles.emplace_back((directory / Detail::DecodeURI(uri)).string()).GetData();
+            }
+
+            if (data.size() < byteLength)
+            {
+                Console::Throw("glTF buffer is shorter than its declared length: {}", path);
+            }
+
+            buffers.push_back(data.first(byteLength));
+        }
+
+        struct PrimitiveJob
+        {
+            Types::UI64 Mesh;
+            Types::UI64 Primitive;
+        };
+
+        std::vector<PrimitiveJob> jobs;
+
+        const auto& meshEntries = document["meshes"].AsArray();
+
+        for (Types::UI64 mesh = 0; mesh < meshEntries.size(); mesh++)
+        {
+            for (Types::UI64 primitive = 0; primitive < meshEntries[mesh]["primitives"].Size(); primitive++)
+            {
+                jobs.push_back({mesh, primitive});
+            }
+        }
+
+        std::vector<ImportedMesh> meshes(jobs.size());
+        std::vector<Types::UI8> built(jobs.size(), 0);
+
+        auto buildPrimitives = [&](Types::UI64 first, Types::UI64 last)
+        {
+            for (Types::UI64 job = first; job < last; job++)
+            {
+                const auto& meshEntry = meshEntries[jobs[job].Mesh];
+
+                std::string name = meshEntry["name"].AsString();
+
+                if (name.empty())
+                {
+                    name = "mesh" + std::to_string(jobs[job].Mesh);
+                }
+
+                meshes[job].Name = name + "/" + std::to_string(jobs[job].Primitive);
+
+                built[job] = BuildGLTFPrimitive(document, meshEntry["primitives"][jobs[job].Primitive], buffers, meshes[job].Data);
+            }
+        };
+
+        Threading::ThreadPool::GetShared().ParallelFor(jobs.size(), 1, buildPrimitives);
+
+        std::vector<ImportedMesh> output;
+
+        output.reserve(jobs.size());
+
+        for (Types::UI64 job = 0; job < jobs.size(); job++)
+        {
+            if (built[job])
+            {
+                output.push_back(std::move(meshes[job]));
+            }
+        }
+
+        return output;
+    }
+
+    bool MeshImporter::BuildGLTFPrimitive(const Files::JsonValue& document, const Files::JsonValue& primitive, std::span<const std::span<const std::byte>> buffers, Mesh& mesh)
+    {
+        if (primitive["mode"].AsUnsigned(4) != 4)
+        {
+            Console::LogWarning("Skipping glTF primitive with non-triangle-list mode {}", primitive["mode"].AsUnsigned());
+
+            return false;
+        }
+
+        const auto& attributeEntries = primitive["attributes"].AsObject();
+
+        if (not primitive["attributes"].Contains("POSITION"))
+        {
+            Console::LogWarning("Skipping glTF primitive without a POSITION attribute");
+
+            return false;
+        }
+
+        std::vector<std::pair<std::string, Types::UI64>> attributeOrder;
+
+        for (const auto& [name, accessor] : attributeEntries)
+        {
+            attributeOrder.emplace_back(name, accessor.AsUnsigned());
+        }
+
+        auto attributeLess = [](const auto& a, const auto& b)
+        {
+            const Types::UI32 rankA = Detail::GetGLTFAttributeRank(a.first);
+            const Types::UI32 rankB = Detail::GetGLTFAttributeRank(b.first);
+
+            return rankA != rankB ? rankA < rankB : a.first < b.first;
+        };
+
+        std::sort(attributeOrder.begin(), attributeOrder.end(), attributeLess);
+
+        const Types::UI64 vertexCount = GetGLTFAccessor(document, primitive["attributes"]["POSITION"].AsUnsigned(), buffers).Count;
+
+        auto format = std::make_shared<VertexFormat>();
+
+        std::vector<GLTFAccessorView> views;
+
+        for (const auto& [name, accessor] : attributeOrder)
+        {
+            const GLTFAccessorView view = GetGLTFAccessor(document, accessor, buffers);
+
+            const auto type = Detail::GetGLTFAttributeType(view.ComponentType, view.Normalized);
+
+            if (not view.Data or not type or view.Count != vertexCount)
+            {
+                Console::LogWarning("Skipping unsupported or mismatched glTF attribute {}", name);
+
+                continue;
+            }
+
+            VertexAttributeBase attribute;
+
+            attribute.EnumType = *type;
+            attribute.TypeSize = Detail::GetGLTFComponentSize(view.ComponentType);
+            attribute.LengthBytes = attribute.TypeSize * view.ComponentCount;
+            attribute.Count = 1;
+
+            format->mAttributes.push_back(attribute);
+
+            views.push_back(view);
+        }
+
+        if (views.empty() or vertexCount == 0)
+        {
+            Console::LogWarning("Skipping glTF primitive without usable vertex data");
+
+            return false;
+        }
+
+        mesh.SetVertexFormat(format);
+        mesh.AllocateStreams(vertexCount);
+
+        const auto& layout = format->GetLayoutDescriptor();
+
+        for (Types::UI64 index = 0; index < views.size(); index++)
+        {
+            const auto& attribute = layout.Attributes[index];
+            const auto& view = views[index];
+
+            const Types::UI64 strideBytes = layout.Streams[attribute.Stream].StrideBytes;
+
+            Memory::StridedCopy(mesh.mStreams[attribute.Stream].data() + attribute.OffsetBytes, strideBytes, view.Data, view.StrideBytes, format->mAttributes[index].LengthBytes, vertexCount);
+        }
+
+        std::vector<Types::UI32> indices;
+
+        if (primitive.Contains("indices"))
+        {
+            const GLTFAccessorView view = GetGLTFAccessor(document, primitive["indices"].AsUnsigned(), buffers);
+
+            if (not view.Data or view.ComponentCount != 1)
+            {
+                Console::LogWarning("Skipping glTF primitive with unsupported index accessor");
+
+                return false;
+            }
+
+            indices.resize(view.Count);
+
+            for (Types::UI64 index = 0; index < view.Count; index++)
+            {
+                const std::byte* element = view.Data + index * view.StrideBytes;
+
+                switch (view.ComponentType)
+                {
+                    case (5121):
+                    {
+                        indices[index] = std::to_integer<Types::UI32>(*element);
+                        break;
+                    }
+                    case (5123):
+                    {
+                        Types::UI16 value;
+
+                        std::memcpy(&value, element, sizeof(value));
+
+                        indices[index] = value;
+                        break;
+                    }
+                    case (5125):
+                    {
+                        std::memcpy(&indices[index], element, sizeof(Types::UI32));
+                        break;
+                    }
+                    default:
+                    {
+                        Console::LogWarning("Skipping glTF primitive with invalid index component type {}", view.ComponentType);
+
+                        return false;
+                    }
+                }
+            }
+        }
+        else
+        {
+            indices.resize(vertexCount);
+
+            std::iota(indices.begin(), indices.end(), 0);
+        }
+
+        mesh.RefreshViews();
+        mesh.SetIndexData(indices);
+
+        return mesh.GetIndexCount() == indices.size();
+    }
+
+    GLTFAccessorView MeshImporter::GetGLTFAccessor(const Files::JsonValue& document, Types::UI64 accessor, std::span<const std::span<const std::byte>> buffers)
+    {
+        const auto& entry = document["accessors"][accessor];
+
+        if (not entry.IsObject())
+        {
+            Console::Throw("glTF accessor {} does not exist", accessor);
+        }
+
+        GLTFAccessorView view = {
+            .Data = nullptr,
+            .Count = entry["count"].AsUnsigned(),
+            .StrideBytes = 0,
+            .ComponentType = static_cast<Types::UI32>(entry["componentType"].AsUnsigned()),
+            .ComponentCount = Detail::GetGLTFComponentCount(entry["type"].AsString()),
+            .Normalized = entry["normalized"].AsBool(),
+        };
+
+        if (entry.Contains("sparse") or not entry.Contains("bufferView") or view.ComponentCount == 0)
+        {
+            return view;
+        }
+
+        const auto& bufferView = document["bufferViews"][entry["bufferView"].AsUnsigned()];
+
+        const Types::UI64 bufferIndex = bufferView["buffer"].AsUnsigned();
+
+        if (not bufferView.IsObject() or bufferIndex >= buffers.size())
+        {
+            Console::Throw("glTF accessor {} references a missing buffer view or buffer", accessor);
+        }
+
+        const Types::UI64 elementSize = Detail::GetGLTFComponentSize(view.ComponentType) * view.ComponentCount;
+        const Types::UI64 viewOffset = bufferView["byteOffset"].AsUnsigned();
+        const Types::UI64 viewLength = bufferView["byteLength"].AsUnsigned();
+        const Types::UI64 offset = viewOffset + entry["byteOffset"].AsUnsigned();
+
+        view.StrideBytes = bufferView["byteStride"].AsUnsigned(elementSize);
+
+        const auto& buffer = buffers[bufferIndex];
+
+        if (elementSize == 0 or viewOffset + viewLength > buffer.size() or (view.Count > 0 and offset + view.StrideBytes * (view.Count - 1) + elementSize > viewOffset + viewLength))
+        {
+            Console::Throw("glTF accessor {} exceeds its buffer view", accessor);
+        }
+
+        view.Data = buffer.data() + offset;
+
+        return view;
+    }
+}
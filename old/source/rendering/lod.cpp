@@ -0,0 +1,51 @@
+#include "rendering/lod.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mosaic::Internal::Rendering
+{
+    LODSelector::LODSelector(Types::F32 pixelErrorThreshold, Types::F32 hysteresis)
+        : mPixelErrorThreshold(pixelErrorThreshold), mHysteresis(hysteresis), mCurrentLevel(0)
+    {
+    }
+
+    Types::UI32 LODSelector::Select(std::span<const MeshLOD> lods, Types::F32 pixelsPerUnit)
+    {
+        if (lods.empty())
+        {
+            mCurrentLevel = 0;
+
+            return mCurrentLevel;
+        }
+
+        mCurrentLevel = std::min<Types::UI32>(mCurrentLevel, lods.size() - 1);
+
+        const Types::F32 coarsenThreshold = mPixelErrorThreshold * (1.0f - mHysteresis);
+        const Types::F32 refineThreshold = mPixelErrorThreshold * (1.0f + mHysteresis);
+
+        while (mCurrentLevel > 0 and lods[mCurrentLevel].Error * pixelsPerUnit > refineThreshold)
+        {
+            mCurrentLevel--;
+        }
+
+        while (mCurrentLevel + 1 < lods.size() and lods[mCurrentLevel + 1].Error * pixelsPerUnit <= coarsenThreshold)
+        {
+            mCurrentLevel++;
+        }
+
+        return mCurrentLevel;
+    }
+
+    Types::UI32 LODSelector::GetCurrentLevel() const
+    {
+        return mCurrentLevel;
+    }
+
+    Types::F32 LODSelector::ComputePixelsPerUnit(Types::F32 distance, Types::F32 verticalFieldOfView, Types::F32 viewportHeight)
+    {
+        const Types::F32 projectedHeight = 2.0f * std::max(distance, 1e-4f) * std::tan(verticalFieldOfView * 0.5f);
+
+        return viewportHeight / projectedHeight;
+    }
+}
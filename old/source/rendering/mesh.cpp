@@ -2,11 +2,197 @@
 
 #include "application/console.hpp"
 
+#include "rendering/optimiser.hpp"
+#include "rendering/simplifier.hpp"
+
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+
 namespace Mosaic::Internal::Rendering
 {
+    VertexFormat& VertexFormat::SetLayout(VertexLayout layout)
+    {
+        mLayout = layout;
+
+        return *this;
+    }
+
+    const VertexLayoutDescriptor& VertexFormat::GetLayoutDescriptor() const
+    {
+        return mLayoutDescriptor;
+    }
+
+    void VertexFormat::ResolveLayout()
+    {
+        std::vector<Types::UI32> requestedStreams;
+
+        mLayoutDescriptor = VertexLayoutDescriptor{.Layout = mLayout, .Streams = {}, .Attributes = {}};
+
+        for (Types::UI32 i = 0; i < mAttributes.size(); i++)
+        {
+            auto& attribute = mAttributes[i];
+
+            const bool automatic = attribute.RequestedStream == VertexAttributeBase::AutomaticStream;
+
+            auto found = requestedStreams.end();
+
+            if (mLayout == VertexLayout::Interleaved)
+            {
+                found = requestedStreams.begin();
+            }
+            else if (not automatic)
+            {
+                found = std::find(requestedStreams.begin(), requestedStreams.end(), attribute.RequestedStream);
+            }
+
+            Types::UI32 stream = std::distance(requestedStreams.begin(), found);
+
+            if (found == requestedStreams.end())
+            {
+                requestedStreams.push_back(attribute.RequestedStream);
+
+                mLayoutDescriptor.Streams.push_back({.Binding = stream, .StrideBytes = 0});
+            }
+
+            auto& streamDescriptor = mLayoutDescriptor.Streams[stream];
+
+            attribute.Index = i;
+            attribute.Stream = stream;
+            attribute.OffsetBytes = streamDescriptor.StrideBytes;
+
+            streamDescriptor.StrideBytes += attribute.LengthBytes;
+
+            mLayoutDescriptor.Attributes.push_back({
+                .Type = attribute.EnumType,
+                .ComponentCount = attribute.LengthBytes / attribute.TypeSize,
+                .Location = i,
+                .Stream = stream,
+                .OffsetBytes = attribute.OffsetBytes,
+            });
+        }
+    }
+
+    struct MeshIdentity::Registry
+    {
+        std::atomic<Types::UI64> NextID = 1;
+        std::atomic<Types::UI64> NextGeneration = 1;
+
+        std::vector<Types::UI64> Released;
+        std::mutex Mutex;
+    };
+
+    MeshIdentity::MeshIdentity()
+        : mID(GetRegistry().NextID++)
+    {
+    }
+
+    MeshIdentity::MeshIdentity(const MeshIdentity&) noexcept
+        : MeshIdentity()
+    {
+    }
+
+    MeshIdentity::~MeshIdentity()
+    {
+        Release(mID);
+    }
+
+    MeshIdentity& MeshIdentity::operator=(const MeshIdentity&) noexcept
+    {
+        return *this;
+    }
+
+    Types::UI64 MeshIdentity::GetID() const
+    {
+        return mID;
+    }
+
+    Types::UI64 MeshIdentity::NextGeneration()
+    {
+        return GetRegistry().NextGeneration++;
+    }
+
+    void MeshIdentity::Release(Types::UI64 id)
+    {
+        Registry& registry = GetRegistry();
+
+        std::lock_guard lock(registry.Mutex);
+
+        registry.Released.push_back(id);
+    }
+
+    std::vector<Types::UI64> MeshIdentity::TakeReleased()
+    {
+        Registry& registry = GetRegistry();
+
+        std::lock_guard lock(registry.Mutex);
+
+        return std::exchange(registry.Released, {});
+    }
+
+    MeshIdentity::Registry& MeshIdentity::GetRegistry()
+    {
+        static Registry registry;
+
+        return registry;
+    }
+
     Mesh::Mesh()
-        : mVertexLengthBytes(0), mFormat(nullptr), mSubmitted(false)
+        : mFormat(nullptr), mVertexCount(0), mIndexCount(0), mIndexType(IndexType::UI16), mUsage(MeshUsage::Static), mGeneration(MeshIdentity::NextGeneration()), mSubmitted(false)
+    {
+    }
+
+    Mesh::Mesh(const Mesh& other)
+        : Mesh()
+    {
+        *this = other;
+    }
+
+    Mesh& Mesh::operator=(const Mesh& other)
     {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        mFormat = other.mFormat;
+
+        mStreams = other.mStreams;
+        mIndexData = other.mIndexData;
+        mLODs = other.mLODs;
+        mMeshlets = other.mMeshlets;
+
+        mMapping = other.mMapping;
+        mOwnedFormat = other.mOwnedFormat;
+
+        mVertexCount = other.mVertexCount;
+        mIndexCount = other.mIndexCount;
+
+        mIndexType = other.mIndexType;
+        mUsage = other.mUsage;
+
+        mDirtyVertexRanges.clear();
+        mDirtyIndexRanges.clear();
+
+        if (not mMapping)
+        {
+            RefreshViews();
+
+            return *this;
+        }
+
+        mStreamViews = other.mStreamViews;
+        mIndexView = other.mIndexView;
+        mLODView = other.mLODView;
+        mMeshletView = other.mMeshletView;
+
+        mGeneration = MeshIdentity::NextGeneration();
+
+        return *this;
     }
 
     void Mesh::SetVertexFormat(VertexFormat& format)
@@ -21,24 +207,698 @@ namespace Mosaic::Internal::Rendering
         }
         else
         {
-
             mFormat = &format;
 
-            for (Types::UI32 i = 0; i < mFormat->mAttributes.size(); i++)
+            mFormat->ResolveLayout();
+        }
+    }
+
+    void Mesh::SetVertexFormat(std::shared_ptr<VertexFormat> format)
+    {
+        if (not format)
+        {
+            Console::LogWarning("Cannot bind mesh to a null vertex format");
+
+            return;
+        }
+
+        SetVertexFormat(*format);
+
+        if (mFormat == format.get())
+        {
+            mOwnedFormat = std::move(format);
+        }
+    }
+
+    const VertexLayoutDescriptor& Mesh::GetLayoutDescriptor() const
+    {
+        if (not mFormat)
+        {
+            Console::Throw("Mesh must be bound to a vertex format before querying its layout");
+
+            throw;
+        }
+
+        return mFormat->mLayoutDescriptor;
+    }
+
+    Types::UI32 Mesh::GetStreamCount() const
+    {
+        return mStreamViews.size();
+    }
+
+    std::span<const std::byte> Mesh::GetStreamData(Types::UI32 stream) const
+    {
+        if (stream >= mStreamViews.size())
+        {
+            Console::Throw("Vertex stream {} out of range, mesh has {} streams", stream, mStreamViews.size());
+
+            throw;
+        }
+
+        return mStreamViews[stream];
+    }
+
+    std::span<const std::byte> Mesh::GetAttributeStreamData(Types::UI32 location) const
+    {
+        const auto& attributes = GetLayoutDescriptor().Attributes;
+
+        if (location >= attributes.size())
+        {
+            Console::Throw("Vertex attribute location {} out of range, format has {} attributes", location, attributes.size());
+
+            throw;
+        }
+
+        return GetStreamData(attributes[location].Stream);
+    }
+
+    Types::UI64 Mesh::GetVertexCount() const
+    {
+        return mVertexCount;
+    }
+
+    void Mesh::AllocateStreams(Types::UI64 vertexCount)
+    {
+        const auto& streams = mFormat->mLayoutDescriptor.Streams;
+
+        mStreams.resize(streams.size());
+
+        for (Types::UI32 stream = 0; stream < streams.size(); stream++)
+        {
+            mStreams[stream].resize(vertexCount * streams[stream].StrideBytes);
+        }
+
+        mVertexCount = vertexCount;
+    }
+
+    void Mesh::SetUsage(MeshUsage usage)
+    {
+        if (not mStreamViews.empty())
+        {
+            Console::LogWarning("Mesh usage must be set before providing vertex data");
+
+            return;
+        }
+
+        mUsage = usage;
+    }
+
+    void Mesh::UpdateIndexRange(Types::UI64 first, std::span<const Types::UI32> indices)
+    {
+        if (not CanUpdateRange())
+        {
+            return;
+        }
+
+        if (indices.empty() or first + indices.size() > mIndexCount)
+        {
+            Console::LogWarning("Mesh index update range [{}, {}) exceeds index count {}", first, first + indices.size(), mIndexCount);
+
+            return;
+        }
+
+        const Types::UI64 limit = mIndexType == IndexType::UI16 ? std::min<Types::UI64>(mVertexCount, MaximumShortIndex + 1) : mVertexCount;
+
+        for (Types::UI32 index : indices)
+        {
+            if (index >= limit)
             {
-                auto& attribute = mFormat->mAttributes[i];
+                Console::LogWarning("Mesh index {} is out of range for the current index buffer", index);
+
+                return;
+            }
+        }
 
-                attribute.Index = i;
-                attribute.OffsetBytes = mVertexLengthBytes;
+        DiscardDerivedData();
+
+        if (mIndexType == IndexType::UI32)
+        {
+            std::memcpy(mIndexData.data() + first * sizeof(Types::UI32), indices.data(), indices.size_bytes());
+        }
+        else
+        {
+            Types::UI16* shortIndices = reinterpret_cast<Types::UI16*>(mIndexData.data()) + first;
 
-                mVertexLengthBytes += attribute.LengthBytes;
+            for (Types::UI64 i = 0; i < indices.size(); i++)
+            {
+                shortIndices[i] = static_cast<Types::UI16>(indices[i]);
             }
         }
+
+        MarkDirty(mDirtyIndexRanges, first, indices.size());
+    }
+
+    MeshUsage Mesh::GetUsage() const
+    {
+        return mUsage;
+    }
+
+    std::span<const MeshDirtyRange> Mesh::GetDirtyVertexRanges() const
+    {
+        return mDirtyVertexRanges;
+    }
+
+    std::span<const MeshDirtyRange> Mesh::GetDirtyIndexRanges() const
+    {
+        return mDirtyIndexRanges;
+    }
+
+    void Mesh::ClearDirtyRanges()
+    {
+        mDirtyVertexRanges.clear();
+        mDirtyIndexRanges.clear();
+    }
+
+    void Mesh::MarkDirty(std::vector<MeshDirtyRange>& ranges, Types::UI64 first, Types::UI64 count)
+    {
+        Types::UI64 last = first + count;
+
+        auto begin = std::lower_bound(ranges.begin(), ranges.end(), first, [](const MeshDirtyRange& range, Types::UI64 value)
+                                      { return range.First + range.Count + DirtyRangeMergeGap < value; });
+
+        auto end = begin;
+
+        while (end != ranges.end() and end->First <= last + DirtyRangeMergeGap)
+        {
+            first = std::min(first, end->First);
+            last = std::max(last, end->First + end->Count);
+
+            end++;
+        }
+
+        begin = ranges.erase(begin, end);
+
+        ranges.insert(begin, {first, last - first});
+    }
+
+    void Mesh::SetIndexData(std::span<const Types::UI32> indices)
+    {
+        if (not CanModify())
+        {
+            return;
+        }
+
+        if (mStreams.empty())
+        {
+            Console::LogWarning("Mesh vertex data must be set before index data");
+
+            return;
+        }
+
+        if (indices.empty() or indices.size() % 3 != 0)
+        {
+            Console::LogWarning("Mesh index data must describe a non-empty triangle list");
+
+            return;
+        }
+
+        for (Types::UI32 index : indices)
+        {
+            if (index >= mVertexCount)
+            {
+                Console::LogWarning("Mesh index {} out of range, mesh has {} vertices", index, mVertexCount);
+
+                return;
+            }
+        }
+
+        PackIndices(indices);
+
+        if (mUsage == MeshUsage::Dynamic)
+        {
+            mDirtyIndexRanges.assign(1, {0, mIndexCount});
+        }
+
+        RefreshViews();
+    }
+
+    void Mesh::Optimise(const MeshOptimisationSettings& settings)
+    {
+        if (not CanModify())
+        {
+            return;
+        }
+
+        if (mStreams.empty())
+        {
+            Console::LogWarning("Mesh must have valid data before being optimised");
+
+            return;
+        }
+
+        if (mSubmitted)
+        {
+            Console::LogWarning("Mesh cannot be optimised after being submitted");
+
+            return;
+        }
+
+        std::vector<Types::UI32> indices = UnpackIndices();
+
+        if (indices.empty())
+        {
+            if (mVertexCount % 3 != 0)
+            {
+                Console::LogWarning("Unindexed mesh vertex count must be a multiple of three to be optimised");
+
+                return;
+            }
+
+            indices.resize(mVertexCount);
+
+            std::iota(indices.begin(), indices.end(), 0);
+        }
+
+        if (settings.Weld)
+        {
+            WeldVertices(indices);
+        }
+
+        if (settings.OptimiseVertexCache)
+        {
+            Optimiser::OptimiseVertexCache(indices, mVertexCount, settings.CacheSize);
+        }
+
+        if (settings.OptimiseOverdraw)
+        {
+            if (const std::byte* positions = GetPositionData(settings.PositionLocation))
+            {
+                const auto& attribute = mFormat->mLayoutDescriptor.Attributes[settings.PositionLocation];
+
+                const VertexStreamView view = {positions, mFormat->mLayoutDescriptor.Streams[attribute.Stream].StrideBytes};
+
+                Optimiser::OptimiseOverdraw(indices, view, mVertexCount, settings.CacheSize);
+            }
+        }
+
+        if (settings.OptimiseVertexFetch)
+        {
+            std::vector<Types::UI32> remap;
+
+            const Types::UI64 vertexCount = Optimiser::GenerateVertexFetchRemap(indices, mVertexCount, remap);
+
+            Optimiser::RemapIndices(indices, remap);
+
+            RemapVertexStreams(remap, vertexCount);
+        }
+
+        PackIndices(indices);
+
+        if (mUsage == MeshUsage::Dynamic)
+        {
+            mDirtyVertexRanges.assign(1, {0, mVertexCount});
+            mDirtyIndexRanges.assign(1, {0, mIndexCount});
+        }
+
+        RefreshViews();
+    }
+
+    void Mesh::GenerateLODs(const LODSettings& settings)
+    {
+        if (not CanModify())
+        {
+            return;
+        }
+
+        if (mIndexCount == 0)
+        {
+            Console::LogWarning("Mesh must have index data before generating LODs");
+
+            return;
+        }
+
+        if (mSubmitted)
+        {
+            Console::LogWarning("Mesh LODs cannot be generated after being submitted");
+
+            return;
+        }
+
+        const std::byte* positionData = GetPositionData(settings.PositionLocation);
+
+        if (not positionData)
+        {
+            return;
+        }
+
+        const auto& layout = mFormat->mLayoutDescriptor;
+
+        const VertexStreamView positions = {positionData, layout.Streams[layout.Attributes[settings.PositionLocation].Stream].StrideBytes};
+
+        std::vector<SimplifierAttributeView> attributes;
+
+        for (const auto& attribute : layout.Attributes)
+        {
+            if (attribute.Location != settings.PositionLocation and attribute.Type == VertexAttributeType::F32)
+            {
+                attributes.push_back({mStreamViews[attribute.Stream].data() + attribute.OffsetBytes, layout.Streams[attribute.Stream].StrideBytes, attribute.ComponentCount});
+            }
+        }
+
+        std::vector<Types::UI32> indices = UnpackIndices();
+
+        PackIndices(indices);
+
+        mLODs.push_back({.IndexOffset = 0, .IndexCount = mIndexCount, .Error = 0.0f});
+
+        const Types::F32 extent = Simplifier::ComputeExtent(indices, positions);
+
+        std::vector<Types::UI32> simplified;
+
+        for (Types::UI32 level = 1; level < settings.LevelCount; level++)
+        {
+            const Types::UI64 triangleCount = indices.size() / 3;
+            const Types::UI64 targetTriangles = std::max<Types::UI64>(triangleCount * settings.TriangleRatio, settings.MinimumTriangleCount);
+
+            if (targetTriangles >= triangleCount)
+            {
+                break;
+            }
+
+            const SimplifierSettings simplifierSettings = {
+                .TargetIndexCount = targetTriangles * 3,
+                .MaximumError = settings.MaximumError,
+                .AttributeWeight = settings.AttributeWeight,
+            };
+
+            const Types::F32 error = Simplifier::Simplify(indices, positions, attributes, mVertexCount, simplifierSettings, simplified);
+
+            if (simplified.empty() or simplified.size() >= indices.size())
+            {
+                break;
+            }
+
+            Optimiser::OptimiseVertexCache(simplified, mVertexCount, MeshOptimisationSettings{}.CacheSize);
+
+            mLODs.push_back({
+                .IndexOffset = mLODs.back().IndexOffset + mLODs.back().IndexCount,
+                .IndexCount = simplified.size(),
+                .Error = std::max(error * extent, mLODs.back().Error),
+            });
+
+            AppendIndices(simplified);
+
+            indices.swap(simplified);
+        }
+
+        RefreshViews();
+    }
+
+    void Mesh::GenerateLODs(std::span<Mesh* const> meshes, const LODSettings& settings)
+    {
+        auto generate = [&](Types::UI64 first, Types::UI64 last)
+        {
+            for (Types::UI64 index = first; index < last; index++)
+            {
+                meshes[index]->GenerateLODs(settings);
+            }
+        };
+
+        Threading::ThreadPool::GetShared().ParallelFor(meshes.size(), 1, generate);
+    }
+
+    void Mesh::GenerateMeshlets(const MeshletSettings& settings)
+    {
+        if (not CanModify())
+        {
+            return;
+        }
+
+        if (mIndexCount == 0)
+        {
+            Console::LogWarning("Mesh must have index data before generating meshlets");
+
+            return;
+        }
+
+        const std::byte* positionData = GetPositionData(settings.PositionLocation);
+
+        if (not positionData)
+        {
+            return;
+        }
+
+        const auto& layout = mFormat->mLayoutDescriptor;
+
+        const VertexStreamView positions = {positionData, layout.Streams[layout.Attributes[settings.PositionLocation].Stream].StrideBytes};
+
+        Meshlets::Build(UnpackIndices(), positions, mVertexCount, settings, mMeshlets);
+
+        RefreshViews();
+    }
+
+    IndexType Mesh::GetIndexType() const
+    {
+        return mIndexType;
+    }
+
+    Types::UI64 Mesh::GetIndexCount() const
+    {
+        return mIndexCount;
+    }
+
+    std::span<const std::byte> Mesh::GetIndexData() const
+    {
+        return mIndexView;
+    }
+
+    std::span<const MeshLOD> Mesh::GetLODs() const
+    {
+        return mLODView;
+    }
+
+    const MeshletView& Mesh::GetMeshlets() const
+    {
+        return mMeshletView;
+    }
+
+    bool Mesh::IsMapped() const
+    {
+        return mMapping != nullptr;
+    }
+
+    void Mesh::DiscardDerivedData()
+    {
+        if (mLODs.empty() and mMeshlets.Meshlets.empty())
+        {
+            return;
+        }
+
+        Console::LogWarning("Mesh LODs and meshlets no longer match the mesh data and were discarded, regenerate them after updating");
+
+        mIndexData.resize(mIndexCount * (mIndexType == IndexType::UI16 ? sizeof(Types::UI16) : sizeof(Types::UI32)));
+
+        mLODs.clear();
+
+        mMeshlets = {};
+
+        RefreshViews();
+    }
+
+    void Mesh::RevalidateIndices()
+    {
+        DiscardDerivedData();
+
+        for (Types::UI32 index : UnpackIndices())
+        {
+            if (index >= mVertexCount)
+            {
+                Console::LogWarning("Mesh index data references vertex {} but the mesh now has {} vertices, index data was discarded", index, mVertexCount);
+
+                mIndexData.clear();
+                mIndexCount = 0;
+                mDirtyIndexRanges.clear();
+
+                return;
+            }
+        }
+    }
+
+    void Mesh::PackIndices(std::span<const Types::UI32> indices)
+    {
+        mLODs.clear();
+
+        mMeshlets = {};
+
+        const Types::UI32 maximum = *std::max_element(indices.begin(), indices.end());
+
+        mIndexCount = indices.size();
+        mIndexType = maximum <= MaximumShortIndex ? IndexType::UI16 : IndexType::UI32;
+
+        if (mIndexType == IndexType::UI32)
+        {
+            mIndexData.resize(indices.size_bytes());
+
+            std::memcpy(mIndexData.data(), indices.data(), indices.size_bytes());
+
+            return;
+        }
+
+        mIndexData.resize(indices.size() * sizeof(Types::UI16));
+
+        Types::UI16* shortIndices = reinterpret_cast<Types::UI16*>(mIndexData.data());
+
+        for (Types::UI64 i = 0; i < indices.size(); i++)
+        {
+            shortIndices[i] = static_cast<Types::UI16>(indices[i]);
+        }
+    }
+
+    void Mesh::AppendIndices(std::span<const Types::UI32> indices)
+    {
+        const Types::UI64 offset = mIndexData.size();
+
+        if (mIndexType == IndexType::UI32)
+        {
+            mIndexData.resize(offset + indices.size_bytes());
+
+            std::memcpy(mIndexData.data() + offset, indices.data(), indices.size_bytes());
+
+            return;
+        }
+
+        mIndexData.resize(offset + indices.size() * sizeof(Types::UI16));
+
+        Types::UI16* shortIndices = reinterpret_cast<Types::UI16*>(mIndexData.data() + offset);
+
+        for (Types::UI64 i = 0; i < indices.size(); i++)
+        {
+            shortIndices[i] = static_cast<Types::UI16>(indices[i]);
+        }
+    }
+
+    std::vector<Types::UI32> Mesh::UnpackIndices() const
+    {
+        std::vector<Types::UI32> indices(mIndexCount);
+
+        if (mIndexType == IndexType::UI32)
+        {
+            std::memcpy(indices.data(), mIndexView.data(), mIndexCount * sizeof(Types::UI32));
+
+            return indices;
+        }
+
+        const Types::UI16* shortIndices = reinterpret_cast<const Types::UI16*>(mIndexView.data());
+
+        for (Types::UI64 i = 0; i < mIndexCount; i++)
+        {
+            indices[i] = shortIndices[i];
+        }
+
+        return indices;
+    }
+
+    void Mesh::WeldVertices(std::vector<Types::UI32>& indices)
+    {
+        std::vector<VertexStreamView> streams;
+
+        for (Types::UI32 stream = 0; stream < mStreams.size(); stream++)
+        {
+            streams.push_back({mStreams[stream].data(), mFormat->mLayoutDescriptor.Streams[stream].StrideBytes});
+        }
+
+        std::vector<Types::UI32> remap;
+
+        const Types::UI64 uniqueCount = Optimiser::GenerateWeldRemap(streams, mVertexCount, remap);
+
+        Optimiser::RemapIndices(indices, remap);
+
+        if (uniqueCount != mVertexCount)
+        {
+            RemapVertexStreams(remap, uniqueCount);
+        }
+    }
+
+    void Mesh::RemapVertexStreams(std::span<const Types::UI32> remap, Types::UI64 newVertexCount)
+    {
+        for (Types::UI32 stream = 0; stream < mStreams.size(); stream++)
+        {
+            const Types::UI64 strideBytes = mFormat->mLayoutDescriptor.Streams[stream].StrideBytes;
+
+            std::vector<std::byte> remapped(newVertexCount * strideBytes);
+
+            Optimiser::RemapVertices(mStreams[stream], remapped, strideBytes, remap);
+
+            mStreams[stream] = std::move(remapped);
+        }
+
+        mVertexCount = newVertexCount;
+    }
+
+    const std::byte* Mesh::GetPositionData(Types::UI32 location) const
+    {
+        const auto& attributes = mFormat->mLayoutDescriptor.Attributes;
+
+        if (location >= attributes.size())
+        {
+            Console::LogWarning("Position attribute location {} out of range", location);
+
+            return nullptr;
+        }
+
+        const auto& attribute = attributes[location];
+
+        if (attribute.Type != VertexAttributeType::F32 or attribute.ComponentCount < 3)
+        {
+            Console::LogWarning("Position attribute must contain at least three F32 components");
+
+            return nullptr;
+        }
+
+        return mStreamViews[attribute.Stream].data() + attribute.OffsetBytes;
+    }
+
+    bool Mesh::CanModify() const
+    {
+        if (mMapping)
+        {
+            Console::LogWarning("Mesh loaded from a mapped file is read-only");
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void Mesh::RefreshViews()
+    {
+        mGeneration = MeshIdentity::NextGeneration();
+
+        mStreamViews.assign(mStreams.begin(), mStreams.end());
+
+        mIndexView = mIndexData;
+        mLODView = mLODs;
+        mMeshletView = mMeshlets.GetView();
+    }
+
+    bool Mesh::CanUpdateRange() const
+    {
+        if (mUsage != MeshUsage::Dynamic)
+        {
+            Console::LogWarning("Only dynamic meshes can be updated in place");
+
+            return false;
+        }
+
+        if (not CanModify())
+        {
+            return false;
+        }
+
+        if (mStreamViews.empty())
+        {
+            Console::LogWarning("Mesh must have vertex data before it can be updated");
+
+            return false;
+        }
+
+        return true;
     }
 
     bool Mesh::CanSetVertexData() const
     {
-        if (not mRawData.empty())
+        if (not mStreamViews.empty() and mUsage == MeshUsage::Static)
         {
             Console::LogWarning("Mesh vertex data cannot be redefined");
             return false;
@@ -70,7 +930,7 @@ namespace Mosaic::Internal::Rendering
             return;
         }
 
-        if (mRawData.empty())
+        if (mStreamViews.empty())
         {
             Console::LogWarning("Mesh must have valid data before being submitted");
 
@@ -90,6 +950,8 @@ namespace Mosaic::Internal::Rendering
 
             return;
         }
+
+        mSubmitted = true;
     }
 
     void Mesh::Unsubmit()
@@ -100,5 +962,24 @@ namespace Mosaic::Internal::Rendering
 
             return;
         }
+
+        MeshIdentity::Release(mIdentity.GetID());
+
+        mSubmitted = false;
+    }
+
+    Types::UI64 Mesh::GetID() const
+    {
+        return mIdentity.GetID();
+    }
+
+    Types::UI64 Mesh::GetGeneration() const
+    {
+        return mGeneration;
+    }
+
+    std::vector<Types::UI64> Mesh::TakeReleasedMeshes()
+    {
+        return MeshIdentity::TakeReleased();
     }
 }
\ No newline at end of file
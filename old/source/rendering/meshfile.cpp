@@ -0,0 +1,356 @@
+#include "rendering/meshfile.hpp"
+#include "rendering/mesh.hpp"
+
+#include "utilities/hash.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Mosaic::Internal::Rendering
+{
+    Types::UI64 MeshFile::Write(const Mesh& mesh, const std::string& path)
+    {
+        const std::vector<std::byte> buffer = Serialise(mesh, path);
+
+        const std::string temporaryPath = path + ".tmp";
+
+        {
+            std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+            if (not out)
+            {
+                Console::Throw("Failed to write mesh file: {}", temporaryPath);
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, path);
+
+        return reinterpret_cast<const MeshFileHeader*>(buffer.data())->ContentHash;
+    }
+
+    Types::UI64 MeshFile::Load(const std::string& path, Mesh& mesh)
+    {
+        auto mapping = std::make_shared<Files::MappedFile>(path);
+
+        const auto file = mapping->GetData();
+
+        return Load(std::move(mapping), file, mesh, path);
+    }
+
+    std::vector<std::byte> MeshFile::Serialise(const Mesh& mesh, const std::string& path)
+    {
+        if (not mesh.mFormat or mesh.mStreamViews.empty())
+        {
+            Console::Throw("Mesh must have a vertex format and vertex data before being written: {}", path);
+        }
+
+        const VertexFormat& format = *mesh.mFormat;
+
+        MeshFileHeader header = {};
+
+        header.Magic = Magic;
+        header.Version = Version;
+        header.Layout = static_cast<Types::UI32>(format.mLayout);
+        header.IndexType = static_cast<Types::UI32>(mesh.mIndexType);
+        header.VertexCount = mesh.mVertexCount;
+        header.IndexCount = mesh.mIndexCount;
+        header.AttributeCount = format.mAttributes.size();
+        header.StreamCount = mesh.mStreamViews.size();
+        header.LODCount = mesh.mLODView.size();
+        header.MeshletCount = mesh.mMeshletView.Meshlets.size();
+
+        std::vector<std::byte> buffer(sizeof(MeshFileHeader));
+
+        const std::vector<MeshFileAttribute> attributes = SerialiseFormat(format);
+
+        header.Attributes = AppendSection(buffer, attributes.data(), attributes.size() * sizeof(MeshFileAttribute));
+
+        std::vector<MeshFileSection> streams;
+
+        for (const auto& stream : mesh.mStreamViews)
+        {
+            streams.push_back(AppendSection(buffer, stream.data(), stream.size()));
+        }
+
+        header.Streams = AppendSection(buffer, streams.data(), streams.size() * sizeof(MeshFileSection));
+
+        header.Indices = AppendSection(buffer, mesh.mIndexView.data(), mesh.mIndexView.size());
+
+        std::vector<std::byte> lods(mesh.mLODView.size() * sizeof(MeshLOD));
+
+        for (Types::UI64 level = 0; level < mesh.mLODView.size(); level++)
+        {
+            std::byte* entry = lods.data() + level * sizeof(MeshLOD);
+
+            std::memcpy(entry + offsetof(MeshLOD, IndexOffset), &mesh.mLODView[level].IndexOffset, sizeof(Types::UI64));
+            std::memcpy(entry + offsetof(MeshLOD, IndexCount), &mesh.mLODView[level].IndexCount, sizeof(Types::UI64));
+            std::memcpy(entry + offsetof(MeshLOD, Error), &mesh.mLODView[level].Error, sizeof(Types::F32));
+        }
+
+        header.LODs = AppendSection(buffer, lods.data(), lods.size());
+
+        const auto& meshlets = mesh.mMeshletView;
+
+        header.Meshlets = AppendSection(buffer, meshlets.Meshlets.data(), meshlets.Meshlets.size_bytes());
+        header.MeshletVertices = AppendSection(buffer, meshlets.Vertices.data(), meshlets.Vertices.size_bytes());
+        header.MeshletTriangles = AppendSection(buffer, meshlets.Triangles.data(), meshlets.Triangles.size_bytes());
+        header.BoundingSpheres = AppendSection(buffer, meshlets.BoundingSpheres.data(), meshlets.BoundingSpheres.size_bytes());
+        header.NormalCones = AppendSection(buffer, meshlets.NormalCones.data(), meshlets.NormalCones.size_bytes());
+
+        header.FileSize = buffer.size();
+        header.ContentHash = Hashing::FNV1a(std::span(buffer).subspan(sizeof(MeshFileHeader)));
+
+        std::memcpy(buffer.data(), &header, sizeof(MeshFileHeader));
+
+        return buffer;
+    }
+
+    Types::UI64 MeshFile::Load(std::shared_ptr<const Files::MappedFile> mapping, std::span<const std::byte> file, Mesh& mesh, const std::string& path)
+    {
+        if (mesh.mFormat or not mesh.mStreamViews.empty())
+        {
+            Console::Throw("Mesh files can only be loaded into an empty mesh: {}", path);
+        }
+
+        if (file.size() < sizeof(MeshFileHeader))
+        {
+            Console::Throw("Mesh file is truncated: {}", path);
+        }
+
+        MeshFileHeader header;
+
+        std::memcpy(&header, file.data(), sizeof(MeshFileHeader));
+
+        if (header.Magic != Magic or header.Version != Version)
+        {
+            Console::Throw("Mesh file has an unsupported signature or version {}: {}", header.Version, path);
+        }
+
+        if (header.FileSize != file.size())
+        {
+            Console::Throw("Mesh file size {} does not match its header {}: {}", file.size(), header.FileSize, path);
+        }
+
+        if (Hashing::FNV1a(file.subspan(sizeof(MeshFileHeader))) != header.ContentHash)
+        {
+            Console::Throw("Mesh file content hash mismatch: {}", path);
+        }
+
+        if (header.IndexType > static_cast<Types::UI32>(IndexType::UI32))
+        {
+            Console::Throw("Mesh file has an unknown index type {}: {}", header.IndexType, path);
+        }
+
+        const auto attributes = GetSection<MeshFileAttribute>(file, header.Attributes);
+        const auto streams = GetSection<MeshFileSection>(file, header.Streams);
+
+        if (attributes.size() != header.AttributeCount or streams.size() != header.StreamCount or attributes.empty())
+        {
+            Console::Throw("Mesh file attribute or stream tables are malformed: {}", path);
+        }
+
+        std::shared_ptr<VertexFormat> format = LoadFormat(header.Layout, attributes, path);
+
+        const auto& layout = format->mLayoutDescriptor;
+
+        if (layout.Streams.size() != streams.size())
+        {
+            Console::Throw("Mesh file stream count does not match its vertex format: {}", path);
+        }
+
+        for (Types::UI32 stream = 0; stream < streams.size(); stream++)
+        {
+            const auto data = GetSection<std::byte>(file, streams[stream]);
+
+            if (data.size() != header.VertexCount * layout.Streams[stream].StrideBytes)
+            {
+                Console::Throw("Mesh file stream {} size does not match its vertex count: {}", stream, path);
+            }
+
+            mesh.mStreamViews.push_back(data);
+        }
+
+        const Types::UI64 indexSize = header.IndexType == static_cast<Types::UI32>(IndexType::UI32) ? sizeof(Types::UI32) : sizeof(Types::UI16);
+
+        mesh.mIndexView = GetSection<std::byte>(file, header.Indices);
+
+        if (mesh.mIndexView.size() % indexSize != 0 or mesh.mIndexView.size() < header.IndexCount * indexSize)
+        {
+            Console::Throw("Mesh file index data is malformed: {}", path);
+        }
+
+        ValidateIndices(mesh.mIndexView, indexSize, header.VertexCount, path);
+
+        mesh.mLODView = GetSection<MeshLOD>(file, header.LODs);
+
+        mesh.mMeshletView = {
+            .Meshlets = GetSection<Meshlet>(file, header.Meshlets),
+            .Vertices = GetSection<Types::UI32>(file, header.MeshletVertices),
+            .Triangles = GetSection<Types::UI8>(file, header.MeshletTriangles),
+            .BoundingSpheres = GetSection<Types::Vec4<Types::F32>>(file, header.BoundingSpheres),
+            .NormalCones = GetSection<Types::Vec4<Types::F32>>(file, header.NormalCones),
+        };
+
+        if (mesh.mLODView.size() != header.LODCount or mesh.mMeshletView.Meshlets.size() != header.MeshletCount)
+        {
+            Console::Throw("Mesh file LOD or meshlet tables are malformed: {}", path);
+        }
+
+        const Types::UI64 totalIndexCount = mesh.mIndexView.size() / indexSize;
+
+        for (const MeshLOD& lod : mesh.mLODView)
+        {
+            if (lod.IndexOffset > totalIndexCount or lod.IndexCount > totalIndexCount - lod.IndexOffset)
+            {
+                Console::Throw("Mesh file LOD index range [{}, {}) exceeds {} indices: {}", lod.IndexOffset, lod.IndexOffset + lod.IndexCount, totalIndexCount, path);
+            }
+        }
+
+        ValidateMeshlets(mesh.mMeshletView, header.VertexCount, path);
+
+        mesh.mOwnedFormat = std::move(format);
+        mesh.mFormat = mesh.mOwnedFormat.get();
+        mesh.mMapping = std::move(mapping);
+        mesh.mGeneration = MeshIdentity::NextGeneration();
+
+        mesh.mVertexCount = header.VertexCount;
+        mesh.mIndexCount = header.IndexCount;
+        mesh.mIndexType = static_cast<IndexType>(header.IndexType);
+
+        return header.ContentHash;
+    }
+
+    void MeshFile::ValidateIndices(std::span<const std::byte> indices, Types::UI64 indexSize, Types::UI64 vertexCount, const std::string& path)
+    {
+        auto validate = [&]<typename T>(std::span<const T> values)
+        {
+            for (T index : values)
+            {
+                if (index >= vertexCount)
+                {
+                    Console::Throw("Mesh file index {} is out of range for {} vertices: {}", index, vertexCount, path);
+                }
+            }
+        };
+
+        if (indexSize == sizeof(Types::UI32))
+        {
+            validate(std::span(reinterpret_cast<const Types::UI32*>(indices.data()), indices.size() / sizeof(Types::UI32)));
+        }
+        else
+        {
+            validate(std::span(reinterpret_cast<const Types::UI16*>(indices.data()), indices.size() / sizeof(Types::UI16)));
+        }
+    }
+
+    void MeshFile::ValidateMeshlets(const MeshletView& meshlets, Types::UI64 vertexCount, const std::string& path)
+    {
+        if (meshlets.BoundingSpheres.size() != meshlets.Meshlets.size() or meshlets.NormalCones.size() != meshlets.Meshlets.size())
+        {
+            Console::Throw("Mesh file meshlet bounds do not match its {} meshlets: {}", meshlets.Meshlets.size(), path);
+        }
+
+        for (const Meshlet& meshlet : meshlets.Meshlets)
+        {
+            const Types::UI64 vertexEnd = static_cast<Types::UI64>(meshlet.VertexOffset) + meshlet.VertexCount;
+            const Types::UI64 triangleEnd = static_cast<Types::UI64>(meshlet.TriangleOffset) + static_cast<Types::UI64>(meshlet.TriangleCount) * 3;
+
+            if (vertexEnd > meshlets.Vertices.size() or triangleEnd > meshlets.Triangles.size())
+            {
+                Console::Throw("Mesh file meshlet exceeds its vertex or triangle tables: {}", path);
+            }
+
+            for (Types::UI64 corner = meshlet.TriangleOffset; corner < triangleEnd; corner++)
+            {
+                if (meshlets.Triangles[corner] >= meshlet.VertexCount)
+                {
+                    Console::Throw("Mesh file meshlet triangle references local vertex {} of {}: {}", meshlets.Triangles[corner], meshlet.VertexCount, path);
+                }
+            }
+        }
+
+        for (Types::UI32 vertex : meshlets.Vertices)
+        {
+            if (vertex >= vertexCount)
+            {
+                Console::Throw("Mesh file meshlet vertex {} is out of range for {} vertices: {}", vertex, vertexCount, path);
+            }
+        }
+    }
+
+    std::vector<MeshFileAttribute> MeshFile::SerialiseFormat(const VertexFormat& format)
+    {
+        std::vector<MeshFileAttribute> attributes;
+
+        for (const auto& attribute : format.mAttributes)
+        {
+            attributes.push_back({
+                .Type = static_cast<Types::UI32>(attribute.EnumType),
+                .LengthBytes = attribute.LengthBytes,
+                .TypeSize = attribute.TypeSize,
+                .Count = attribute.Count,
+                .Stream = attribute.Stream,
+                .Reserved = 0,
+            });
+        }
+
+        return attributes;
+    }
+
+    std::shared_ptr<VertexFormat> MeshFile::LoadFormat(Types::UI32 layout, std::span<const MeshFileAttribute> attributes, const std::string& path)
+    {
+        if (layout > static_cast<Types::UI32>(VertexLayout::Deinterleaved))
+        {
+            Console::Throw("Mesh file has an unknown vertex layout {}: {}", layout, path);
+        }
+
+        auto format = std::make_shared<VertexFormat>();
+
+        format->mLayout = static_cast<VertexLayout>(layout);
+
+        for (const auto& entry : attributes)
+        {
+            if (entry.Type > static_cast<Types::UI32>(VertexAttributeType::SNorm1010102))
+            {
+                Console::Throw("Mesh file attribute has an unknown type {}: {}", entry.Type, path);
+            }
+
+            if (entry.TypeSize == 0 or entry.LengthBytes == 0 or entry.LengthBytes % entry.TypeSize != 0)
+            {
+                Console::Throw("Mesh file attribute has an invalid size of {} bytes with {} byte components: {}", entry.LengthBytes, entry.TypeSize, path);
+            }
+
+            VertexAttributeBase attribute;
+
+            attribute.EnumType = static_cast<VertexAttributeType>(entry.Type);
+            attribute.LengthBytes = entry.LengthBytes;
+            attribute.TypeSize = entry.TypeSize;
+            attribute.Count = entry.Count;
+            attribute.RequestedStream = entry.Stream;
+
+            format->mAttributes.push_back(attribute);
+        }
+
+        format->ResolveLayout();
+
+        return format;
+    }
+
+    MeshFileSection MeshFile::AppendSection(std::vector<std::byte>& buffer, const void* data, Types::UI64 size)
+    {
+        const Types::UI64 offset = (buffer.size() + SectionAlignment - 1) / SectionAlignment * SectionAlignment;
+
+        buffer.resize(offset + size);
+
+        if (size > 0)
+        {
+            std::memcpy(buffer.data() + offset, data, size);
+        }
+
+        return {offset, size};
+    }
+}
@@ -0,0 +1,300 @@
+#include "rendering/meshlets.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Mosaic::Internal::Rendering::Meshlets::Detail
+{
+    struct Point
+    {
+        Types::F32 X = 0.0f;
+        Types::F32 Y = 0.0f;
+        Types::F32 Z = 0.0f;
+    };
+
+    Point LoadPoint(const VertexStreamView& positions, Types::UI32 vertex)
+    {
+        Point point;
+
+        std::memcpy(&point, positions.Data + vertex * positions.StrideBytes, sizeof(Point));
+
+        return point;
+    }
+
+    Point Subtract(const Point& a, const Point& b)
+    {
+        return {a.X - b.X, a.Y - b.Y, a.Z - b.Z};
+    }
+
+    Point Cross(const Point& a, const Point& b)
+    {
+        return {a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X};
+    }
+
+    Types::F32 Dot(const Point& a, const Point& b)
+    {
+        return a.X * b.X + a.Y * b.Y + a.Z * b.Z;
+    }
+
+    Types::F32 DistanceSquared(const Point& a, const Point& b)
+    {
+        const Point delta = Subtract(a, b);
+
+        return Dot(delta, delta);
+    }
+
+    Types::Vec4<Types::F32> ComputeBoundingSphere(const MeshletData& data, const Meshlet& meshlet, const VertexStreamView& positions)
+    {
+        auto vertex = [&](Types::UI32 local)
+        {
+            return LoadPoint(positions, data.Vertices[meshlet.VertexOffset + local]);
+        };
+
+        const Point first = vertex(0);
+
+        Point farthest = first;
+
+        for (Types::UI32 local = 1; local < meshlet.VertexCount; local++)
+        {
+            if (DistanceSquared(vertex(local), first) > DistanceSquared(farthest, first))
+            {
+                farthest = vertex(local);
+            }
+        }
+
+        Point opposite = farthest;
+
+        for (Types::UI32 local = 0; local < meshlet.VertexCount; local++)
+        {
+            if (DistanceSquared(vertex(local), farthest) > DistanceSquared(opposite, farthest))
+            {
+                opposite = vertex(local);
+            }
+        }
+
+        Point center = {(farthest.X + opposite.X) * 0.5f, (farthest.Y + opposite.Y) * 0.5f, (farthest.Z + opposite.Z) * 0.5f};
+
+        Types::F32 radius = std::sqrt(DistanceSquared(farthest, opposite)) * 0.5f;
+
+        for (Types::UI32 local = 0; local < meshlet.VertexCount; local++)
+        {
+            const Point point = vertex(local);
+
+            const Types::F32 distance = std::sqrt(DistanceSquared(point, center));
+
+            if (distance > radius)
+            {
+                const Types::F32 grownRadius = (radius + distance) * 0.5f;
+                const Types::F32 shift = (grownRadius - radius) / distance;
+
+                center = {center.X + (point.X - center.X) * shift, center.Y + (point.Y - center.Y) * shift, center.Z + (point.Z - center.Z) * shift};
+                radius = grownRadius;
+            }
+        }
+
+        return Types::Vec4<Types::F32>(center.X, center.Y, center.Z, radius);
+    }
+
+    Types::Vec4<Types::F32> ComputeNormalCone(const MeshletData& data, const Meshlet& meshlet, const VertexStreamView& positions)
+    {
+        std::vector<Point> normals;
+
+        normals.reserve(meshlet.TriangleCount);
+
+        Point axis;
+
+        for (Types::UI32 triangle = 0; triangle < meshlet.TriangleCount; triangle++)
+        {
+            const Types::UI8* corners = &data.Triangles[meshlet.TriangleOffset + triangle * 3];
+
+            const Point a = LoadPoint(positions, data.Vertices[meshlet.VertexOffset + corners[0]]);
+            const Point b = LoadPoint(positions, data.Vertices[meshlet.VertexOffset + corners[1]]);
+            const Point c = LoadPoint(positions, data.Vertices[meshlet.VertexOffset + corners[2]]);
+
+            const Point normal = Cross(Subtract(b, a), Subtract(c, a));
+
+            const Types::F32 length = std::sqrt(Dot(normal, normal));
+
+            if (length <= 0.0f)
+            {
+                continue;
+            }
+
+            normals.push_back({normal.X / length, normal.Y / length, normal.Z / length});
+
+            axis = {axis.X + normals.back().X, axis.Y + normals.back().Y, axis.Z + normals.back().Z};
+        }
+
+        const Types::F32 axisLength = std::sqrt(Dot(axis, axis));
+
+        if (normals.empty() or axisLength <= 0.0f)
+        {
+            return Types::Vec4<Types::F32>(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        axis = {axis.X / axisLength, axis.Y / axisLength, axis.Z / axisLength};
+
+        Types::F32 minimumDot = 1.0f;
+
+        for (const Point& normal : normals)
+        {
+            minimumDot = std::min(minimumDot, Dot(normal, axis));
+        }
+
+        const Types::F32 cutoff = minimumDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minimumDot * minimumDot);
+
+        return Types::Vec4<Types::F32>(axis.X, axis.Y, axis.Z, cutoff);
+    }
+
+    void FinishMeshlet(MeshletData& data, Meshlet& meshlet, const VertexStreamView& positions)
+    {
+        if (meshlet.TriangleCount == 0)
+        {
+            return;
+        }
+
+        data.Meshlets.push_back(meshlet);
+        data.BoundingSpheres.push_back(ComputeBoundingSphere(data, meshlet, positions));
+        data.NormalCones.push_back(ComputeNormalCone(data, meshlet, positions));
+
+        meshlet = {
+            .VertexOffset = static_cast<Types::UI32>(data.Vertices.size()),
+            .TriangleOffset = static_cast<Types::UI32>(data.Triangles.size()),
+            .VertexCount = 0,
+            .TriangleCount = 0,
+        };
+    }
+}
+
+namespace Mosaic::Internal::Rendering
+{
+    MeshletView MeshletData::GetView() const
+    {
+        return {Meshlets, Vertices, Triangles, BoundingSpheres, NormalCones};
+    }
+}
+
+namespace Mosaic::Internal::Rendering::Meshlets
+{
+    void Build(std::span<const Types::UI32> indices, const VertexStreamView& positions, Types::UI64 vertexCount, const MeshletSettings& settings, MeshletData& outData)
+    {
+        outData = {};
+
+        if (settings.MaximumVertices < 3 or settings.MaximumVertices > 256 or settings.MaximumTriangles == 0)
+        {
+            Console::LogWarning("Meshlets must allow between 3 and 256 vertices and at least one triangle");
+
+            return;
+        }
+
+        constexpr Types::UI8 Unassigned = 0xFF;
+
+        std::vector<Types::UI8> localIndices(vertexCount, Unassigned);
+        std::vector<Types::UI32> localVertexOwners(vertexCount, ~0u);
+
+        Meshlet meshlet = {};
+
+        for (Types::UI64 triangle = 0; triangle < indices.size() / 3; triangle++)
+        {
+            const Types::UI32* corners = &indices[triangle * 3];
+
+            const Types::UI32 meshletIndex = outData.Meshlets.size();
+
+            Types::UI32 newVertices = 0;
+
+            for (Types::UI32 corner = 0; corner < 3; corner++)
+            {
+                const bool repeated = (corner > 0 and corners[corner] == corners[0]) or (corner > 1 and corners[corner] == corners[1]);
+
+                if (not repeated and localVertexOwners[corners[corner]] != meshletIndex)
+                {
+                    newVertices++;
+                }
+            }
+
+            if (meshlet.VertexCount + newVertices > settings.MaximumVertices or meshlet.TriangleCount + 1 > settings.MaximumTriangles)
+            {
+                Detail::FinishMeshlet(outData, meshlet, positions);
+            }
+
+            const Types::UI32 currentIndex = outData.Meshlets.size();
+
+            for (Types::UI32 corner = 0; corner < 3; corner++)
+            {
+                const Types::UI32 vertex = corners[corner];
+
+                if (localVertexOwners[vertex] != currentIndex)
+                {
+                    localVertexOwners[vertex] = currentIndex;
+                    localIndices[vertex] = meshlet.VertexCount++;
+
+                    outData.Vertices.push_back(vertex);
+                }
+
+                outData.Triangles.push_back(localIndices[vertex]);
+            }
+
+            meshlet.TriangleCount++;
+        }
+
+        Detail::FinishMeshlet(outData, meshlet, positions);
+    }
+
+    MeshletCullStatistics Cull(const MeshletView& data, const std::array<Types::Vec4<Types::F32>, 6>& frustumPlanes, const Types::Vec3<Types::F32>& cameraPosition, std::vector<Types::UI32>& outVisible)
+    {
+        MeshletCullStatistics statistics;
+
+        outVisible.clear();
+
+        for (Types::UI32 index = 0; index < data.Meshlets.size(); index++)
+        {
+            const auto& sphere = data.BoundingSpheres[index];
+            const auto& cone = data.NormalCones[index];
+
+            const Types::UI64 triangleCount = data.Meshlets[index].TriangleCount;
+
+            statistics.MeshletsTested++;
+            statistics.TrianglesTested += triangleCount;
+
+            bool outside = false;
+
+            for (const auto& plane : frustumPlanes)
+            {
+                if (plane.X * sphere.X + plane.Y * sphere.Y + plane.Z * sphere.Z + plane.W < -sphere.W)
+                {
+                    outside = true;
+
+                    break;
+                }
+            }
+
+            if (outside)
+            {
+                statistics.FrustumRejected++;
+
+                continue;
+            }
+
+            const Detail::Point offset = {sphere.X - cameraPosition.X, sphere.Y - cameraPosition.Y, sphere.Z - cameraPosition.Z};
+
+            const Types::F32 distance = std::sqrt(Detail::Dot(offset, offset));
+
+            if (Detail::Dot(offset, {cone.X, cone.Y, cone.Z}) >= cone.W * distance + sphere.W)
+            {
+                statistics.ConeRejected++;
+
+                continue;
+            }
+
+            statistics.MeshletsVisible++;
+            statistics.TrianglesVisible += triangleCount;
+
+            outVisible.push_back(index);
+        }
+
+        return statistics;
+    }
+}
@@ -0,0 +1,160 @@
+#include "rendering/null/renderer.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace Mosaic::Internal::Rendering
+{
+    NullRenderer::NullRenderer(Renderer& renderer)
+        : mReportInterval(0), mRenderer(renderer)
+    {
+    }
+
+    const NullRendererStatistics& NullRenderer::GetFrameStatistics() const
+    {
+        return mFrameStatistics;
+    }
+
+    const NullRendererStatistics& NullRenderer::GetTotalStatistics() const
+    {
+        return mTotalStatistics;
+    }
+
+    void NullRenderer::Create()
+    {
+        Console::LogNotice("Null renderer created, no GPU work will be issued");
+    }
+
+    void NullRenderer::Update()
+    {
+        const RendererFramePacket& frame = *mRenderer.mFrame;
+
+        mFrameStatistics = {.Frames = 1};
+
+        mBoundPipeline.reset();
+
+        for (Types::UI64 mesh : frame.ReleasedMeshes)
+        {
+            mResidentMeshes.erase(mesh);
+        }
+
+        for (const RendererMeshUpload& upload : frame.MeshUploads)
+        {
+            Upload(upload);
+        }
+
+        for (const RendererPacketCommand& command : frame.Commands)
+        {
+            Execute(command);
+        }
+
+        mTotalStatistics.Frames++;
+        mTotalStatistics.Commands += mFrameStatistics.Commands;
+        mTotalStatistics.Draws += mFrameStatistics.Draws;
+        mTotalStatistics.Instances += mFrameStatistics.Instances;
+        mTotalStatistics.RenderPasses += mFrameStatistics.RenderPasses;
+        mTotalStatistics.StateChanges += mFrameStatistics.StateChanges;
+        mTotalStatistics.BytesUploaded += mFrameStatistics.BytesUploaded;
+        mTotalStatistics.ValidationErrors += mFrameStatistics.ValidationErrors;
+
+        if (mReportInterval != 0 and mTotalStatistics.Frames % mReportInterval == 0)
+        {
+            Report();
+        }
+    }
+
+    void NullRenderer::LoadConfig()
+    {
+        Files::TOMLFile config;
+
+        config.Open(mRenderer.mConfigPath);
+
+        mReportInterval = config.Get<Types::UI64>("Renderer.Null.ReportInterval", 0);
+    }
+
+    void NullRenderer::Execute(const RendererPacketCommand& command)
+    {
+        mFrameStatistics.Commands++;
+
+        auto execute = [&]<typename T>(const T& command)
+        {
+            if constexpr (std::is_same_v<T, RendererDraw>)
+            {
+                if (not mBoundPipeline)
+                {
+                    Invalid("Draw issued without a bound pipeline");
+                }
+
+                if (not mResidentMeshes.contains(command.Mesh))
+                {
+                    Invalid("Draw issued for a mesh without vertex data");
+
+                    return;
+                }
+
+                if (command.InstanceCount == 0)
+                {
+                    Invalid("Draw issued with an instance count of zero");
+                }
+
+                mFrameStatistics.Draws++;
+                mFrameStatistics.Instances += command.InstanceCount;
+            }
+            else if constexpr (std::is_same_v<T, RendererPassBegin>)
+            {
+                mBoundPipeline.reset();
+
+                mFrameStatistics.RenderPasses++;
+            }
+            else if constexpr (std::is_same_v<T, RendererPipelineBind>)
+            {
+                if (std::exchange(mBoundPipeline, command.Pipeline->Hash) == command.Pipeline->Hash)
+                {
+                    Invalid("Redundant pipeline bind reached the backend");
+                }
+
+                mFrameStatistics.StateChanges++;
+            }
+            else
+            {
+                mFrameStatistics.StateChanges++;
+            }
+        };
+
+        std::visit(execute, command);
+    }
+
+    void NullRenderer::Upload(const RendererMeshUpload& upload)
+    {
+        mResidentMeshes.insert(upload.Mesh);
+
+        for (const RendererMeshWrite& write : upload.Writes)
+        {
+            mFrameStatistics.BytesUploaded += write.Data.size();
+        }
+    }
+
+    void NullRenderer::Report() const
+    {
+        Console::LogNotice("Null renderer frame {}: {} commands, {} draws, {} instances, {} passes, {} state changes, {} bytes uploaded, {} validation errors",
+                           mTotalStatistics.Frames,
+                           mFrameStatistics.Commands,
+                           mFrameStatistics.Draws,
+                           mFrameStatistics.Instances,
+                           mFrameStatistics.RenderPasses,
+                           mFrameStatistics.StateChanges,
+                           mFrameStatistics.BytesUploaded,
+                           mFrameStatistics.ValidationErrors);
+    }
+
+    void NullRenderer::Invalid(const std::string& message)
+    {
+        mFrameStatistics.ValidationErrors++;
+
+        Console::LogWarning(message);
+    }
+}
@@ -8,7 +8,7 @@
 namespace Mosaic::Internal::Rendering
 {
     OpenGLRenderer::OpenGLRenderer(Renderer& renderer)
-        : mRenderer(renderer)
+        : mViewportSize(0, 0), mRenderer(renderer)
     {
     }
 
@@ -29,13 +29,20 @@ namespace Mosaic::Internal::Rendering
         {
             Console::Throw("Failed to fetch OpenGL extensions: {}", SDL_GetError());
         }
-
-        mRenderer.mEventManager.Subscribe(this, &OpenGLRenderer::OnResize);
     }
 
     void OpenGLRenderer::Update()
     {
-        glClearColor(mRenderer.mClearColour.X, mRenderer.mClearColour.Y, mRenderer.mClearColour.Z, mRenderer.mClearColour.W);
+        const RendererFramePacket& frame = *mRenderer.mFrame;
+
+        if (frame.WindowSize.X != mViewportSize.X or frame.WindowSize.Y != mViewportSize.Y)
+        {
+            mViewportSize = frame.WindowSize;
+
+            glViewport(0, 0, mViewportSize.X, mViewportSize.Y);
+        }
+
+        glClearColor(frame.ClearColour.X, frame.ClearColour.Y, frame.ClearColour.Z, frame.ClearColour.W);
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -75,9 +82,4 @@ namespace Mosaic::Internal::Rendering
             }
         }
     }
-
-    void OpenGLRenderer::OnResize(const Windowing::WindowResizeEvent& event)
-    {
-        glViewport(0, 0, event.Size.X, event.Size.Y);
-    }
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <GL/glew.h>
+
+#include "application/console.hpp"
+
+#include "rendering/opengl/vertex.hpp"
+
+namespace Mosaic::Internal::Rendering
+{
+    OpenGLVertexArray::OpenGLVertexArray()
+        : mHandle(0)
+    {
+    }
+
+    void OpenGLVertexArray::Create(const VertexLayoutDescriptor& layout)
+    {
+        if (mHandle)
+        {
+            Destroy();
+        }
+
+        glCreateVertexArrays(1, &mHandle);
+
+        mStreams = layout.Streams;
+
+        for (const auto& attribute : layout.Attributes)
+        {
+            const Types::UI32 binding = layout.Streams[attribute.Stream].Binding;
+
+            const GLint size = attribute.ComponentCount;
+
+            switch (attribute.Type)
+            {
+                case (VertexAttributeType::F32):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_FLOAT, GL_FALSE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::F16):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_HALF_FLOAT, GL_FALSE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::F64):
+                {
+                    glVertexArrayAttribLFormat(mHandle, attribute.Location, size, GL_DOUBLE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::I8):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_BYTE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::I16):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_SHORT, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::I32):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_INT, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UI8):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_UNSIGNED_BYTE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UI16):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_UNSIGNED_SHORT, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UI32):
+                {
+                    glVertexArrayAttribIFormat(mHandle, attribute.Location, size, GL_UNSIGNED_INT, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UNorm8):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_UNSIGNED_BYTE, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UNorm16):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_UNSIGNED_SHORT, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::SNorm8):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_BYTE, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::SNorm16):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, size, GL_SHORT, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::UNorm1010102):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, 4, GL_UNSIGNED_INT_2_10_10_10_REV, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::SNorm1010102):
+                {
+                    glVertexArrayAttribFormat(mHandle, attribute.Location, 4, GL_INT_2_10_10_10_REV, GL_TRUE, attribute.OffsetBytes);
+                    break;
+                }
+                case (VertexAttributeType::I64):
+                case (VertexAttributeType::UI64):
+                {
+                    Console::LogWarning("OpenGL does not support 64-bit integer vertex attributes, skipping location {}", attribute.Location);
+                    continue;
+                }
+            }
+
+            glVertexArrayAttribBinding(mHandle, attribute.Location, binding);
+            glEnableVertexArrayAttrib(mHandle, attribute.Location);
+        }
+    }
+
+    void OpenGLVertexArray::Destroy()
+    {
+        glDeleteVertexArrays(1, &mHandle);
+
+        mHandle = 0;
+
+        mStreams.clear();
+    }
+
+    void OpenGLVertexArray::BindStreams(std::span<const Types::UI32> buffers)
+    {
+        if (buffers.size() != mStreams.size())
+        {
+            Console::LogWarning("Vertex array expects {} stream buffers, got {}", mStreams.size(), buffers.size());
+
+            return;
+        }
+
+        for (Types::UI32 stream = 0; stream < mStreams.size(); stream++)
+        {
+            glVertexArrayVertexBuffer(mHandle, mStreams[stream].Binding, buffers[stream], 0, mStreams[stream].StrideBytes);
+        }
+    }
+
+    void OpenGLVertexArray::Bind() const
+    {
+        glBindVertexArray(mHandle);
+    }
+
+    Types::UI32 OpenGLVertexArray::Get() const
+    {
+        return mHandle;
+    }
+}
@@ -0,0 +1,455 @@
+#include "rendering/optimiser.hpp"
+
+#include "utilities/hash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace Mosaic::Internal::Rendering::Optimiser::Detail
+{
+    struct Point
+    {
+        Types::F32 X = 0.0f;
+        Types::F32 Y = 0.0f;
+        Types::F32 Z = 0.0f;
+
+        Point operator+(const Point& other) const { return {X + other.X, Y + other.Y, Z + other.Z}; }
+        Point operator-(const Point& other) const { return {X - other.X, Y - other.Y, Z - other.Z}; }
+        Point operator*(Types::F32 scale) const { return {X * scale, Y * scale, Z * scale}; }
+
+        Point Cross(const Point& other) const { return {Y * other.Z - Z * other.Y, Z * other.X - X * other.Z, X * other.Y - Y * other.X}; }
+        Types::F32 Dot(const Point& other) const { return X * other.X + Y * other.Y + Z * other.Z; }
+        Types::F32 Length() const { return std::sqrt(Dot(*this)); }
+    };
+
+    Point LoadPoint(const VertexStreamView& positions, Types::UI32 vertex)
+    {
+        Point point;
+
+        std::memcpy(&point, positions.Data + vertex * positions.StrideBytes, sizeof(Point));
+
+        return point;
+    }
+
+    struct TriangleAdjacency
+    {
+        std::vector<Types::UI32> Offsets;
+        std::vector<Types::UI32> Counts;
+        std::vector<Types::UI32> Triangles;
+    };
+
+    void BuildAdjacency(std::span<const Types::UI32> indices, Types::UI64 vertexCount, TriangleAdjacency& adjacency)
+    {
+        adjacency.Offsets.assign(vertexCount, 0);
+        adjacency.Counts.assign(vertexCount, 0);
+        adjacency.Triangles.resize(indices.size());
+
+        for (Types::UI32 index : indices)
+        {
+            adjacency.Counts[index]++;
+        }
+
+        Types::UI32 offset = 0;
+
+        for (Types::UI64 vertex = 0; vertex < vertexCount; vertex++)
+        {
+            adjacency.Offsets[vertex] = offset;
+
+            offset += adjacency.Counts[vertex];
+        }
+
+        std::vector<Types::UI32> cursor = adjacency.Offsets;
+
+        for (Types::UI64 corner = 0; corner < indices.size(); corner++)
+        {
+            adjacency.Triangles[cursor[indices[corner]]++] = corner / 3;
+        }
+    }
+
+    bool VerticesEqual(std::span<const VertexStreamView> streams, Types::UI32 a, Types::UI32 b)
+    {
+        for (const auto& stream : streams)
+        {
+            if (std::memcmp(stream.Data + a * stream.StrideBytes, stream.Data + b * stream.StrideBytes, stream.StrideBytes) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    Types::UI64 HashVertex(std::span<const VertexStreamView> streams, Types::UI32 vertex)
+    {
+        Types::UI64 hash = Hashing::FNV1aOffsetBasis;
+
+        for (const auto& stream : streams)
+        {
+            hash = Hashing::FNV1a(std::span(stream.Data + vertex * stream.StrideBytes, stream.StrideBytes), hash);
+        }
+
+        return hash;
+    }
+
+    Types::I64 SkipDeadEnd(const std::vector<Types::UI32>& liveCounts, std::vector<Types::UI32>& deadEnds, Types::UI64& cursor)
+    {
+        while (not deadEnds.empty())
+        {
+            const Types::UI32 vertex = deadEnds.back();
+
+            deadEnds.pop_back();
+
+            if (liveCounts[vertex] > 0)
+            {
+                return vertex;
+            }
+        }
+
+        while (cursor < liveCounts.size())
+        {
+            if (liveCounts[cursor] > 0)
+            {
+                return cursor;
+            }
+
+            cursor++;
+        }
+
+        return -1;
+    }
+
+    Types::I64 NextFanningVertex(const std::vector<Types::UI32>& candidates, const std::vector<Types::UI32>& liveCounts, const std::vector<Types::UI32>& timestamps, Types::UI32 time, Types::UI32 cacheSize)
+    {
+        Types::I64 best = -1;
+        Types::I64 bestPriority = -1;
+
+        for (Types::UI32 vertex : candidates)
+        {
+            if (liveCounts[vertex] == 0)
+            {
+                continue;
+            }
+
+            Types::I64 priority = 0;
+
+            if (time - timestamps[vertex] + 2 * liveCounts[vertex] <= cacheSize)
+            {
+                priority = time - timestamps[vertex];
+            }
+
+            if (priority > bestPriority)
+            {
+                best = vertex;
+                bestPriority = priority;
+            }
+        }
+
+        return best;
+    }
+
+    void FindClusters(std::span<const Types::UI32> indices, Types::UI64 vertexCount, Types::UI32 cacheSize, std::vector<Types::UI32>& outClusterStarts)
+    {
+        std::vector<Types::UI32> timestamps(vertexCount, 0);
+
+        Types::UI32 time = cacheSize + 1;
+
+        outClusterStarts.clear();
+
+        for (Types::UI64 triangle = 0; triangle < indices.size() / 3; triangle++)
+        {
+            Types::UI32 misses = 0;
+
+            for (Types::UI32 corner = 0; corner < 3; corner++)
+            {
+                const Types::UI32 vertex = indices[triangle * 3 + corner];
+
+                if (time - timestamps[vertex] > cacheSize)
+                {
+                    timestamps[vertex] = time++;
+
+                    misses++;
+                }
+            }
+
+            if (triangle == 0 or misses == 3)
+            {
+                outClusterStarts.push_back(triangle);
+            }
+        }
+    }
+}
+
+namespace Mosaic::Internal::Rendering::Optimiser
+{
+    Types::UI64 GenerateWeldRemap(std::span<const VertexStreamView> streams, Types::UI64 vertexCount, std::vector<Types::UI32>& outRemap)
+    {
+        outRemap.assign(vertexCount, UnusedVertex);
+
+        Types::UI64 tableSize = 1;
+
+        while (tableSize < vertexCount * 2)
+        {
+            tableSize <<= 1;
+        }
+
+        std::vector<Types::UI32> table(tableSize, UnusedVertex);
+
+        Types::UI64 uniqueCount = 0;
+
+        for (Types::UI32 vertex = 0; vertex < vertexCount; vertex++)
+        {
+            Types::UI64 slot = Detail::HashVertex(streams, vertex) & (tableSize - 1);
+
+            while (table[slot] != UnusedVertex and not Detail::VerticesEqual(streams, table[slot], vertex))
+            {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            if (table[slot] == UnusedVertex)
+            {
+                table[slot] = vertex;
+
+                outRemap[vertex] = uniqueCount++;
+            }
+            else
+            {
+                outRemap[vertex] = outRemap[table[slot]];
+            }
+        }
+
+        return uniqueCount;
+    }
+
+    void OptimiseVertexCache(std::span<Types::UI32> indices, Types::UI64 vertexCount, Types::UI32 cacheSize)
+    {
+        if (indices.size() < 3)
+        {
+            return;
+        }
+
+        Detail::TriangleAdjacency adjacency;
+
+        Detail::BuildAdjacency(indices, vertexCount, adjacency);
+
+        std::vector<Types::UI32> liveCounts = adjacency.Counts;
+        std::vector<Types::UI32> timestamps(vertexCount, 0);
+        std::vector<bool> emitted(indices.size() / 3, false);
+
+        std::vector<Types::UI32> deadEnds;
+        std::vector<Types::UI32> candidates;
+
+        std::vector<Types::UI32> output;
+
+        output.reserve(indices.size());
+
+        Types::UI32 time = cacheSize + 1;
+        Types::UI64 cursor = 0;
+
+        Types::I64 fanning = Detail::SkipDeadEnd(liveCounts, deadEnds, cursor);
+
+        while (fanning >= 0)
+        {
+            candidates.clear();
+
+            const Types::UI32 first = adjacency.Offsets[fanning];
+            const Types::UI32 last = first + adjacency.Counts[fanning];
+
+            for (Types::UI32 entry = first; entry < last; entry++)
+            {
+                const Types::UI32 triangle = adjacency.Triangles[entry];
+
+                if (emitted[triangle])
+                {
+                    continue;
+                }
+
+                for (Types::UI32 corner = 0; corner < 3; corner++)
+                {
+                    const Types::UI32 vertex = indices[triangle * 3 + corner];
+
+                    output.push_back(vertex);
+
+                    deadEnds.push_back(vertex);
+                    candidates.push_back(vertex);
+
+                    liveCounts[vertex]--;
+
+                    if (time - timestamps[vertex] > cacheSize)
+                    {
+                        timestamps[vertex] = time++;
+                    }
+                }
+
+                emitted[triangle] = true;
+            }
+
+            fanning = Detail::NextFanningVertex(candidates, liveCounts, timestamps, time, cacheSize);
+
+            if (fanning < 0)
+            {
+                fanning = Detail::SkipDeadEnd(liveCounts, deadEnds, cursor);
+            }
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void OptimiseOverdraw(std::span<Types::UI32> indices, const VertexStreamView& positions, Types::UI64 vertexCount, Types::UI32 cacheSize)
+    {
+        const Types::UI64 triangleCount = indices.size() / 3;
+
+        if (triangleCount < 2)
+        {
+            return;
+        }
+
+        std::vector<Types::UI32> clusterStarts;
+
+        Detail::FindClusters(indices, vertexCount, cacheSize, clusterStarts);
+
+        if (clusterStarts.size() < 2)
+        {
+            return;
+        }
+
+        const Types::UI64 clusterCount = clusterStarts.size();
+
+        std::vector<Detail::Point> centroids(clusterCount);
+        std::vector<Detail::Point> normals(clusterCount);
+
+        Detail::Point meshCentroid;
+
+        Types::F32 meshArea = 0.0f;
+
+        for (Types::UI64 cluster = 0; cluster < clusterCount; cluster++)
+        {
+            const Types::UI64 first = clusterStarts[cluster];
+            const Types::UI64 last = cluster + 1 < clusterCount ? clusterStarts[cluster + 1] : triangleCount;
+
+            Detail::Point centroid;
+            Detail::Point normal;
+
+            Types::F32 clusterArea = 0.0f;
+
+            for (Types::UI64 triangle = first; triangle < last; triangle++)
+            {
+                const auto a = Detail::LoadPoint(positions, indices[triangle * 3 + 0]);
+                const auto b = Detail::LoadPoint(positions, indices[triangle * 3 + 1]);
+                const auto c = Detail::LoadPoint(positions, indices[triangle * 3 + 2]);
+
+                const auto crossed = (b - a).Cross(c - a);
+
+                const Types::F32 area = crossed.Length();
+
+                centroid = centroid + (a + b + c) * (area / 3.0f);
+                normal = normal + crossed;
+
+                clusterArea += area;
+            }
+
+            meshCentroid = meshCentroid + centroid;
+            meshArea += clusterArea;
+
+            const Types::F32 normalLength = normal.Length();
+
+            centroids[cluster] = clusterArea > 0.0f ? centroid * (1.0f / clusterArea) : Detail::LoadPoint(positions, indices[first * 3]);
+            normals[cluster] = normalLength > 0.0f ? normal * (1.0f / normalLength) : normal;
+        }
+
+        if (meshArea > 0.0f)
+        {
+            meshCentroid = meshCentroid * (1.0f / meshArea);
+        }
+
+        std::vector<Types::F32> sortKeys(clusterCount);
+
+        for (Types::UI64 cluster = 0; cluster < clusterCount; cluster++)
+        {
+            sortKeys[cluster] = (centroids[cluster] - meshCentroid).Dot(normals[cluster]);
+        }
+
+        std::vector<Types::UI32> order(clusterCount);
+
+        std::iota(order.begin(), order.end(), 0);
+
+        std::stable_sort(order.begin(), order.end(), [&](Types::UI32 a, Types::UI32 b)
+                         { return sortKeys[a] > sortKeys[b]; });
+
+        std::vector<Types::UI32> output;
+
+        output.reserve(indices.size());
+
+        for (Types::UI32 cluster : order)
+        {
+            const Types::UI64 first = clusterStarts[cluster];
+            const Types::UI64 last = cluster + 1 < clusterCount ? clusterStarts[cluster + 1] : triangleCount;
+
+            output.insert(output.end(), indices.begin() + first * 3, indices.begin() + last * 3);
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    Types::UI64 GenerateVertexFetchRemap(std::span<const Types::UI32> indices, Types::UI64 vertexCount, std::vector<Types::UI32>& outRemap)
+    {
+        outRemap.assign(vertexCount, UnusedVertex);
+
+        Types::UI64 nextVertex = 0;
+
+        for (Types::UI32 index : indices)
+        {
+            if (outRemap[index] == UnusedVertex)
+            {
+                outRemap[index] = nextVertex++;
+            }
+        }
+
+        return nextVertex;
+    }
+
+    void RemapIndices(std::span<Types::UI32> indices, std::span<const Types::UI32> remap)
+    {
+        for (Types::UI32& index : indices)
+        {
+            index = remap[index];
+        }
+    }
+
+    void RemapVertices(std::span<const std::byte> source, std::span<std::byte> destination, Types::UI64 strideBytes, std::span<const Types::UI32> remap)
+    {
+        for (Types::UI64 vertex = 0; vertex < remap.size(); vertex++)
+        {
+            if (remap[vertex] != UnusedVertex)
+            {
+                std::memcpy(destination.data() + remap[vertex] * strideBytes, source.data() + vertex * strideBytes, strideBytes);
+            }
+        }
+    }
+
+    Types::F32 ComputeACMR(std::span<const Types::UI32> indices, Types::UI64 vertexCount, Types::UI32 cacheSize)
+    {
+        if (indices.size() < 3)
+        {
+            return 0.0f;
+        }
+
+        std::vector<Types::UI32> timestamps(vertexCount, 0);
+
+        Types::UI32 time = cacheSize + 1;
+        Types::UI64 misses = 0;
+
+        for (Types::UI32 vertex : indices)
+        {
+            if (time - timestamps[vertex] > cacheSize)
+            {
+                timestamps[vertex] = time++;
+
+                misses++;
+            }
+        }
+
+        return static_cast<Types::F32>(misses) / static_cast<Types::F32>(indices.size() / 3);
+    }
+}
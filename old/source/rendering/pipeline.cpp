@@ -0,0 +1,121 @@
+#include "rendering/pipeline.hpp"
+#include "rendering/mesh.hpp"
+
+#include "utilities/hash.hpp"
+
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace Mosaic::Internal::Rendering
+{
+    Shader::Shader(ShaderStage stage, std::vector<Types::UI32> code, const std::string& entryPoint)
+        : mStage(stage), mCode(std::move(code)), mEntryPoint(entryPoint)
+    {
+        mHash = Hashing::FNV1a(std::as_bytes(std::span(mCode)));
+        mHash = Hashing::Combine(mHash, Hashing::FNV1a(std::string_view(mEntryPoint)));
+        mHash = Hashing::Combine(mHash, static_cast<Types::UI64>(mStage));
+    }
+
+    ShaderStage Shader::GetStage() const
+    {
+        return mStage;
+    }
+
+    std::span<const Types::UI32> Shader::GetCode() const
+    {
+        return mCode;
+    }
+
+    const std::string& Shader::GetEntryPoint() const
+    {
+        return mEntryPoint;
+    }
+
+    Types::UI64 Shader::GetHash() const
+    {
+        return mHash;
+    }
+
+    PipelineSnapshot::PipelineSnapshot(const PipelineDescriptor& descriptor)
+        : Descriptor(descriptor), Hash(Pipeline::Hash(descriptor))
+    {
+        for (const Shader*& shader : Descriptor.Shaders)
+        {
+            if (shader)
+            {
+                shader = Shaders.emplace_back(std::make_shared<const Shader>(*shader)).get();
+            }
+        }
+
+        if (Descriptor.Format)
+        {
+            Format = std::make_shared<const VertexFormat>(*Descriptor.Format);
+
+            Descriptor.Format = Format.get();
+        }
+    }
+
+    Pipeline::Pipeline(const PipelineDescriptor& descriptor)
+        : mDescriptor(descriptor), mHash(Hash(descriptor))
+    {
+    }
+
+    const PipelineDescriptor& Pipeline::GetDescriptor() const
+    {
+        return mDescriptor;
+    }
+
+    Types::UI64 Pipeline::GetHash() const
+    {
+        return mHash;
+    }
+
+    bool Pipeline::IsValid() const
+    {
+        return not mDescriptor.Shaders.empty();
+    }
+
+    Types::UI64 Pipeline::Hash(const PipelineDescriptor& descriptor)
+    {
+        Types::UI64 hash = Hashing::FNV1a(descriptor.Shaders.size());
+
+        for (const Shader* shader : descriptor.Shaders)
+        {
+            hash = Hashing::Combine(hash, shader ? shader->GetHash() : 0);
+        }
+
+        if (descriptor.Format)
+        {
+            const VertexLayoutDescriptor& layout = descriptor.Format->GetLayoutDescriptor();
+
+            hash = Hashing::Combine(hash, static_cast<Types::UI64>(layout.Layout));
+
+            for (const VertexStreamDescriptor& stream : layout.Streams)
+            {
+                hash = Hashing::Combine(hash, static_cast<Types::UI64>(stream.Binding) << 32 | stream.StrideBytes);
+            }
+
+            for (const VertexAttributeDescriptor& attribute : layout.Attributes)
+            {
+                hash = Hashing::Combine(hash, static_cast<Types::UI64>(attribute.Type) << 32 | attribute.ComponentCount);
+                hash = Hashing::Combine(hash, static_cast<Types::UI64>(attribute.Location) << 32 | attribute.Stream);
+                hash = Hashing::Combine(hash, attribute.OffsetBytes);
+            }
+        }
+
+        hash = Hashing::Combine(hash, static_cast<Types::UI64>(descriptor.Topology) << 16 | static_cast<Types::UI64>(descriptor.Cull) << 8 | static_cast<Types::UI64>(descriptor.Blend));
+        hash = Hashing::Combine(hash, static_cast<Types::UI64>(descriptor.Depth.Compare) << 2 | descriptor.Depth.Test << 1 | descriptor.Depth.Write);
+
+        hash = Hashing::Combine(hash, descriptor.ColourFormats.size());
+
+        for (Types::UI32 format : descriptor.ColourFormats)
+        {
+            hash = Hashing::Combine(hash, format);
+        }
+
+        hash = Hashing::Combine(hash, static_cast<Types::UI64>(descriptor.DepthFormat) << 32 | descriptor.SampleCount);
+
+        return hash;
+    }
+}
\ No newline at end of file
@@ -1,20 +1,74 @@
+#include "rendering/null/renderer.hpp"
 #include "rendering/opengl/renderer.hpp"
 #include "rendering/vulkan/renderer.hpp"
 
+#include "application/window.hpp"
+
 #include "utilities/config.hpp"
 
+#include <chrono>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
 namespace Mosaic::Internal::Rendering
 {
     Renderer::Renderer(Windowing::Window& window, EventManager& eventManager)
-        : mConfigPath(""), mBackend(nullptr), mWindow(window), mEventManager(eventManager)
+        : mConfigPath(""), mFrame(nullptr), mBackendTiming(false), mFrameIndex(0), mThreaded(false), mBackend(nullptr), mWindow(window), mEventManager(eventManager)
     {
     }
 
+    Renderer::~Renderer()
+    {
+        if (mRenderThread.joinable())
+        {
+            mRenderThread.request_stop();
+            mRenderThread.join();
+        }
+
+        delete mBackend;
+    }
+
     void Renderer::SetConfigPath(const std::string& path)
     {
         mConfigPath = path;
     }
 
+    void Renderer::SetFrameData(std::span<const std::byte> data)
+    {
+        mFrameData.assign(data.begin(), data.end());
+    }
+
+    void RendererInterface::PrewarmPipelines(std::span<const Pipeline>)
+    {
+    }
+
+    void Renderer::PrewarmPipelines(std::span<const Pipeline> pipelines)
+    {
+        if (not mBackend)
+        {
+            Console::LogWarning("Pipelines cannot be prewarmed before the renderer is configured");
+
+            return;
+        }
+
+        mBackend->PrewarmPipelines(pipelines);
+    }
+
+    void Renderer::SetBackendTiming(bool enabled)
+    {
+        mBackendTiming = enabled;
+    }
+
+    std::vector<Types::F64> Renderer::TakeBackendTimes()
+    {
+        std::lock_guard lock(mBackendTimesMutex);
+
+        return std::exchange(mBackendTimes, {});
+    }
+
     void Renderer::LoadConfig()
     {
         Files::TOMLFile config;
@@ -25,6 +79,8 @@ namespace Mosaic::Internal::Rendering
         auto clearColour = config.Get<Types::F32, 4>("Renderer.ClearColour", {0.0, 0.0, 0.0, 1.0});
         auto vsync = config.Get<std::string>("Renderer.VSync");
 
+        mThreaded = config.Get<bool>("Renderer.Threaded", false);
+
         if (api == "OpenGL")
         {
             mAPI = RendererAPI::OpenGL;
@@ -35,6 +91,11 @@ namespace Mosaic::Internal::Rendering
             mAPI = RendererAPI::Vulkan;
             mBackend = new VulkanRenderer(*this);
         }
+        else if (api == "Null")
+        {
+            mAPI = RendererAPI::Null;
+            mBackend = new NullRenderer(*this);
+        }
         else
         {
             Console::Throw("Unsupported rendering API \"{}\"", api);
@@ -62,21 +123,280 @@ namespace Mosaic::Internal::Rendering
         mClearColour.Z = clearColour[2];
         mClearColour.W = clearColour[3];
 
+        mWindow.Initialise();
+
         mBackend->LoadConfig();
     }
 
     void Renderer::Create()
     {
-        mBackend->Create();
+        if (not mThreaded)
+        {
+            mBackend->Create();
+
+            return;
+        }
+
+        std::promise<void> created;
+
+        auto ready = created.get_future();
+
+        mRenderThread = std::jthread([this, &created](std::stop_token stop)
+                                     {
+                                         try
+                                         {
+                                             mBackend->Create();
+                                         }
+                                         catch (...)
+                                         {
+                                             created.set_exception(std::current_exception());
+
+                                             return;
+                                         }
+
+                                         created.set_value();
+
+                                         RenderLoop(stop); });
+
+        ready.get();
     }
 
     void Renderer::Update()
     {
+        if (not mThreaded)
+        {
+            WritePacket(mImmediateFrame);
+
+            mFrame = &mImmediateFrame;
+
+            UpdateBackend();
+
+            return;
+        }
+
+        WritePacket(mFrames.BeginWrite());
+
+        mFrames.EndWrite();
+
+        std::lock_guard lock(mRenderErrorMutex);
+
+        if (mRenderError)
+        {
+            std::rethrow_exception(mRenderError);
+        }
+    }
+
+    void Renderer::Stop()
+    {
+        if (not mRenderThread.joinable())
+        {
+            return;
+        }
+
+        mRenderThread.request_stop();
+        mRenderThread.join();
+
+        std::lock_guard lock(mRenderErrorMutex);
+
+        if (mRenderError)
+        {
+            std::rethrow_exception(mRenderError);
+        }
+    }
+
+    void Renderer::WritePacket(RendererFramePacket& packet)
+    {
+        packet.Commands.clear();
+        packet.MeshUploads.clear();
+
+        packet.ReleasedMeshes = Mesh::TakeReleasedMeshes();
+
+        for (Types::UI64 mesh : packet.ReleasedMeshes)
+        {
+            mUploadedMeshes.erase(mesh);
+        }
+
+        auto write = [&]<typename T>(const T& command)
+        {
+            if constexpr (std::is_same_v<T, DrawCommand>)
+            {
+                WriteMeshUpload(command.mMesh, packet);
+
+                packet.Commands.push_back(RendererDraw{command.mMeshID, command.mInstanceCount});
+            }
+            else if constexpr (std::is_same_v<T, PipelineInteractCommand>)
+            {
+                packet.Commands.push_back(RendererPipelineBind{SnapshotPipeline(command.mPipeline)});
+            }
+            else if constexpr (std::is_same_v<T, ShaderInteractCommand>)
+            {
+                packet.Commands.push_back(RendererShaderBind{command.mShader.GetHash()});
+            }
+            else if constexpr (std::is_same_v<T, BufferInteractCommand>)
+            {
+                packet.Commands.push_back(RendererBufferBind{});
+            }
+            else if constexpr (std::is_same_v<T, RenderPassCommand>)
+            {
+                packet.Commands.push_back(RendererPassBegin{});
+            }
+            else if constexpr (std::is_same_v<T, VSyncStateSetCommand> or std::is_same_v<T, SwapColourSetCommand>)
+            {
+                packet.Commands.push_back(command);
+            }
+        };
+
+        for (const RendererCommandWrapper& command : mCommands)
+        {
+            std::visit(write, command);
+        }
+
+        packet.FrameData.assign(mFrameData.begin(), mFrameData.end());
+
+        packet.ClearColour = mClearColour;
+        packet.WindowSize = mWindow.mSize;
+        packet.FrameIndex = mFrameIndex++;
+    }
+
+    void Renderer::WriteMeshUpload(Mesh& mesh, RendererFramePacket& packet)
+    {
+        if (mesh.GetVertexCount() == 0)
+        {
+            return;
+        }
+
+        Types::UI64& uploaded = mUploadedMeshes[mesh.GetID()];
+
+        const bool rebuilt = uploaded != mesh.GetGeneration();
+
+        if (not rebuilt and mesh.GetDirtyVertexRanges().empty() and mesh.GetDirtyIndexRanges().empty())
+        {
+            return;
+        }
+
+        uploaded = mesh.GetGeneration();
+
+        RendererMeshUpload& upload = packet.MeshUploads.emplace_back();
+
+        upload.Mesh = mesh.GetID();
+        upload.Generation = mesh.GetGeneration();
+        upload.VertexCount = mesh.GetVertexCount();
+        upload.IndexBytes = mesh.GetIndexData().size();
+
+        for (Types::UI32 stream = 0; stream < mesh.GetStreamCount(); stream++)
+        {
+            upload.StreamBytes.push_back(mesh.GetStreamData(stream).size());
+        }
+
+        auto write = [&](Types::UI32 stream, std::span<const std::byte> data, Types::UI64 offset)
+        {
+            if (not data.empty())
+            {
+                upload.Writes.push_back({stream, offset, std::vector<std::byte>(data.begin(), data.end())});
+            }
+        };
+
+        if (rebuilt)
+        {
+            for (Types::UI32 stream = 0; stream < mesh.GetStreamCount(); stream++)
+            {
+                write(stream, mesh.GetStreamData(stream), 0);
+            }
+
+            write(RendererMeshUpload::IndexStream, mesh.GetIndexData(), 0);
+        }
+        else
+        {
+            const auto& layout = mesh.GetLayoutDescriptor();
+
+            for (const MeshDirtyRange& range : mesh.GetDirtyVertexRanges())
+            {
+                for (Types::UI32 stream = 0; stream < mesh.GetStreamCount(); stream++)
+                {
+                    const Types::UI64 stride = layout.Streams[stream].StrideBytes;
+
+                    write(stream, mesh.GetStreamData(stream).subspan(range.First * stride, range.Count * stride), range.First * stride);
+                }
+            }
+
+            const Types::UI64 indexSize = mesh.GetIndexType() == IndexType::UI16 ? sizeof(Types::UI16) : sizeof(Types::UI32);
+
+            for (const MeshDirtyRange& range : mesh.GetDirtyIndexRanges())
+            {
+                write(RendererMeshUpload::IndexStream, mesh.GetIndexData().subspan(range.First * indexSize, range.Count * indexSize), range.First * indexSize);
+            }
+        }
+
+        mesh.ClearDirtyRanges();
+    }
+
+    std::shared_ptr<const PipelineSnapshot> Renderer::SnapshotPipeline(const Pipeline& pipeline)
+    {
+        std::shared_ptr<const PipelineSnapshot>& snapshot = mPipelineSnapshots[pipeline.GetHash()];
+
+        if (not snapshot)
+        {
+            snapshot = std::make_shared<const PipelineSnapshot>(pipeline.GetDescriptor());
+        }
+
+        return snapshot;
+    }
+
+    void Renderer::RenderLoop(std::stop_token stop)
+    {
+        bool failed = false;
+
+        while (RendererFramePacket* packet = mFrames.BeginRead(stop))
+        {
+            if (not failed)
+            {
+                mFrame = packet;
+
+                try
+                {
+                    UpdateBackend();
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(mRenderErrorMutex);
+
+                    mRenderError = std::current_exception();
+
+                    failed = true;
+                }
+            }
+
+            mFrames.EndRead();
+        }
+    }
+
+    void Renderer::UpdateBackend()
+    {
+        if (not mBackendTiming)
+        {
+            mBackend->Update();
+
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
         mBackend->Update();
+
+        const Types::F64 elapsed = std::chrono::duration<Types::F64, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard lock(mBackendTimesMutex);
+
+        mBackendTimes.push_back(elapsed);
     }
 
-    void Renderer::UpdateCommands(const std::vector<RendererCommandWrapper>& newCommands)
+    void Renderer::UpdateCommands(std::span<const RendererCommandWrapper> commands)
     {
         mCommands.clear();
+
+        for (const RendererCommandWrapper& command : commands)
+        {
+            mCommands.push_back(command);
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,387 @@
+#include "rendering/simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Mosaic::Internal::Rendering::Simplifier::Detail
+{
+    struct Position
+    {
+        Types::F64 X = 0.0;
+        Types::F64 Y = 0.0;
+        Types::F64 Z = 0.0;
+    };
+
+    struct Quadric
+    {
+        Types::F64 XX = 0.0, XY = 0.0, XZ = 0.0, XW = 0.0;
+        Types::F64 YY = 0.0, YZ = 0.0, YW = 0.0;
+        Types::F64 ZZ = 0.0, ZW = 0.0;
+        Types::F64 WW = 0.0;
+    };
+
+    struct Collapse
+    {
+        Types::UI32 Source;
+        Types::UI32 Target;
+        Types::F64 Cost;
+    };
+
+    Position Subtract(const Position& a, const Position& b)
+    {
+        return {a.X - b.X, a.Y - b.Y, a.Z - b.Z};
+    }
+
+    Position Cross(const Position& a, const Position& b)
+    {
+        return {a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X};
+    }
+
+    Types::F64 Dot(const Position& a, const Position& b)
+    {
+        return a.X * b.X + a.Y * b.Y + a.Z * b.Z;
+    }
+
+    void AddPlane(Quadric& quadric, const Position& normal, Types::F64 distance, Types::F64 weight)
+    {
+        quadric.XX += weight * normal.X * normal.X;
+        quadric.XY += weight * normal.X * normal.Y;
+        quadric.XZ += weight * normal.X * normal.Z;
+        quadric.XW += weight * normal.X * distance;
+        quadric.YY += weight * normal.Y * normal.Y;
+        quadric.YZ += weight * normal.Y * normal.Z;
+        quadric.YW += weight * normal.Y * distance;
+        quadric.ZZ += weight * normal.Z * normal.Z;
+        quadric.ZW += weight * normal.Z * distance;
+        quadric.WW += weight * distance * distance;
+    }
+
+    void Accumulate(Quadric& target, const Quadric& source)
+    {
+        target.XX += source.XX;
+        target.XY += source.XY;
+        target.XZ += source.XZ;
+        target.XW += source.XW;
+        target.YY += source.YY;
+        target.YZ += source.YZ;
+        target.YW += source.YW;
+        target.ZZ += source.ZZ;
+        target.ZW += source.ZW;
+        target.WW += source.WW;
+    }
+
+    Types::F64 Evaluate(const Quadric& q, const Position& p)
+    {
+        const Types::F64 error = q.XX * p.X * p.X + 2.0 * q.XY * p.X * p.Y + 2.0 * q.XZ * p.X * p.Z + 2.0 * q.XW * p.X
+                               + q.YY * p.Y * p.Y + 2.0 * q.YZ * p.Y * p.Z + 2.0 * q.YW * p.Y
+                               + q.ZZ * p.Z * p.Z + 2.0 * q.ZW * p.Z
+                               + q.WW;
+
+        return std::abs(error);
+    }
+
+    Types::F64 AttributeDistance(std::span<const SimplifierAttributeView> attributes, Types::UI32 a, Types::UI32 b)
+    {
+        Types::F64 distance = 0.0;
+
+        for (const auto& attribute : attributes)
+        {
+            for (Types::UI32 component = 0; component < attribute.ComponentCount; component++)
+            {
+                Types::F32 valueA;
+                Types::F32 valueB;
+
+                std::memcpy(&valueA, attribute.Data + a * attribute.StrideBytes + component * sizeof(Types::F32), sizeof(Types::F32));
+                std::memcpy(&valueB, attribute.Data + b * attribute.StrideBytes + component * sizeof(Types::F32), sizeof(Types::F32));
+
+                const Types::F64 delta = valueA - valueB;
+
+                distance += delta * delta;
+            }
+        }
+
+        return distance;
+    }
+
+    bool FlipsTriangle(std::span<const Types::UI32> indices, const std::vector<Position>& positions, const std::vector<Types::UI32>& offsets, const std::vector<Types::UI32>& triangles, Types::UI32 source, Types::UI32 target)
+    {
+        for (Types::UI32 entry = offsets[source]; entry < offsets[source + 1]; entry++)
+        {
+            const Types::UI32 triangle = triangles[entry];
+
+            const Types::UI32 a = indices[triangle * 3 + 0];
+            const Types::UI32 b = indices[triangle * 3 + 1];
+            const Types::UI32 c = indices[triangle * 3 + 2];
+
+            if (a == target or b == target or c == target)
+            {
+                continue;
+            }
+
+            const Position& pa = positions[a];
+            const Position& pb = positions[b];
+            const Position& pc = positions[c];
+
+            const Position before = Cross(Subtract(pb, pa), Subtract(pc, pa));
+
+            const Position& qa = a == source ? positions[target] : pa;
+            const Position& qb = b == source ? positions[target] : pb;
+            const Position& qc = c == source ? positions[target] : pc;
+
+            const Position after = Cross(Subtract(qb, qa), Subtract(qc, qa));
+
+            if (Dot(before, after) <= 0.0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+namespace Mosaic::Internal::Rendering::Simplifier
+{
+    Types::F32 ComputeExtent(std::span<const Types::UI32> indices, const VertexStreamView& positions)
+    {
+        Types::F32 minimum[3] = {std::numeric_limits<Types::F32>::max(), std::numeric_limits<Types::F32>::max(), std::numeric_limits<Types::F32>::max()};
+        Types::F32 maximum[3] = {std::numeric_limits<Types::F32>::lowest(), std::numeric_limits<Types::F32>::lowest(), std::numeric_limits<Types::F32>::lowest()};
+
+        for (Types::UI32 index : indices)
+        {
+            Types::F32 point[3];
+
+            std::memcpy(point, positions.Data + index * positions.StrideBytes, sizeof(point));
+
+            for (Types::UI32 axis = 0; axis < 3; axis++)
+            {
+                minimum[axis] = std::min(minimum[axis], point[axis]);
+                maximum[axis] = std::max(maximum[axis], point[axis]);
+            }
+        }
+
+        return std::max({maximum[0] - minimum[0], maximum[1] - minimum[1], maximum[2] - minimum[2], 0.0f});
+    }
+
+    Types::F32 Simplify(std::span<const Types::UI32> indices, const VertexStreamView& positions, std::span<const SimplifierAttributeView> attributes, Types::UI64 vertexCount, const SimplifierSettings& settings, std::vector<Types::UI32>& outIndices)
+    {
+        outIndices.assign(indices.begin(), indices.end());
+
+        const Types::F32 extent = ComputeExtent(indices, positions);
+
+        if (outIndices.size() <= settings.TargetIndexCount or extent <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        const Types::F64 scale = 1.0 / extent;
+
+        std::vector<Detail::Position> points(vertexCount);
+
+        for (Types::UI64 vertex = 0; vertex < vertexCount; vertex++)
+        {
+            Types::F32 point[3];
+
+            std::memcpy(point, positions.Data + vertex * positions.StrideBytes, sizeof(point));
+
+            points[vertex] = {point[0] * scale, point[1] * scale, point[2] * scale};
+        }
+
+        std::vector<Detail::Quadric> quadrics(vertexCount);
+
+        for (Types::UI64 triangle = 0; triangle < outIndices.size() / 3; triangle++)
+        {
+            const auto& a = points[outIndices[triangle * 3 + 0]];
+            const auto& b = points[outIndices[triangle * 3 + 1]];
+            const auto& c = points[outIndices[triangle * 3 + 2]];
+
+            Detail::Position normal = Detail::Cross(Detail::Subtract(b, a), Detail::Subtract(c, a));
+
+            const Types::F64 length = std::sqrt(Detail::Dot(normal, normal));
+
+            if (length <= 0.0)
+            {
+                continue;
+            }
+
+            normal = {normal.X / length, normal.Y / length, normal.Z / length};
+
+            const Types::F64 distance = -Detail::Dot(normal, a);
+
+            for (Types::UI32 corner = 0; corner < 3; corner++)
+            {
+                Detail::AddPlane(quadrics[outIndices[triangle * 3 + corner]], normal, distance, length * 0.5);
+            }
+        }
+
+        const Types::F64 errorLimit = static_cast<Types::F64>(settings.MaximumError) * settings.MaximumError;
+
+        Types::F64 resultError = 0.0;
+
+        std::vector<Types::UI32> offsets;
+        std::vector<Types::UI32> triangles;
+        std::vector<Types::UI64> edges;
+        std::vector<Detail::Collapse> collapses;
+        std::vector<Types::UI32> remap(vertexCount);
+        std::vector<bool> locked(vertexCount);
+
+        while (outIndices.size() > settings.TargetIndexCount)
+        {
+            const Types::UI64 triangleCount = outIndices.size() / 3;
+
+            offsets.assign(vertexCount + 1, 0);
+            triangles.resize(outIndices.size());
+
+            for (Types::UI32 index : outIndices)
+            {
+                offsets[index + 1]++;
+            }
+
+            for (Types::UI64 vertex = 0; vertex < vertexCount; vertex++)
+            {
+                offsets[vertex + 1] += offsets[vertex];
+            }
+
+            std::vector<Types::UI32> cursor(offsets.begin(), offsets.end() - 1);
+
+            for (Types::UI64 corner = 0; corner < outIndices.size(); corner++)
+            {
+                triangles[cursor[outIndices[corner]]++] = corner / 3;
+            }
+
+            edges.clear();
+
+            for (Types::UI64 triangle = 0; triangle < triangleCount; triangle++)
+            {
+                for (Types::UI32 corner = 0; corner < 3; corner++)
+                {
+                    const Types::UI32 a = outIndices[triangle * 3 + corner];
+                    const Types::UI32 b = outIndices[triangle * 3 + (corner + 1) % 3];
+
+                    edges.push_back((static_cast<Types::UI64>(std::min(a, b)) << 32) | std::max(a, b));
+                }
+            }
+
+            std::sort(edges.begin(), edges.end());
+
+            std::fill(locked.begin(), locked.end(), false);
+
+            collapses.clear();
+
+            for (Types::UI64 first = 0; first < edges.size();)
+            {
+                Types::UI64 last = first + 1;
+
+                while (last < edges.size() and edges[last] == edges[first])
+                {
+                    last++;
+                }
+
+                const Types::UI32 a = edges[first] >> 32;
+                const Types::UI32 b = edges[first] & 0xFFFFFFFFu;
+
+                if (last - first == 1)
+                {
+                    locked[a] = true;
+                    locked[b] = true;
+                }
+                else
+                {
+                    collapses.push_back({a, b, 0.0});
+                }
+
+                first = last;
+            }
+
+            for (auto& collapse : collapses)
+            {
+                const Types::F64 penalty = settings.AttributeWeight * Detail::AttributeDistance(attributes, collapse.Source, collapse.Target);
+
+                const Types::F64 forward = locked[collapse.Source] ? std::numeric_limits<Types::F64>::max() : Detail::Evaluate(quadrics[collapse.Source], points[collapse.Target]);
+                const Types::F64 backward = locked[collapse.Target] ? std::numeric_limits<Types::F64>::max() : Detail::Evaluate(quadrics[collapse.Target], points[collapse.Source]);
+
+                if (backward < forward)
+                {
+                    std::swap(collapse.Source, collapse.Target);
+                }
+
+                collapse.Cost = std::min(forward, backward) + penalty;
+            }
+
+            std::erase_if(collapses, [&](const Detail::Collapse& collapse)
+                          { return collapse.Cost > errorLimit; });
+
+            std::sort(collapses.begin(), collapses.end(), [](const Detail::Collapse& a, const Detail::Collapse& b)
+                      { return a.Cost < b.Cost; });
+
+            for (Types::UI64 vertex = 0; vertex < vertexCount; vertex++)
+            {
+                remap[vertex] = vertex;
+            }
+
+            std::vector<bool> touched(vertexCount, false);
+
+            const Types::UI64 trianglesToRemove = (outIndices.size() - settings.TargetIndexCount + 2) / 3;
+
+            Types::UI64 removedEstimate = 0;
+
+            for (const auto& collapse : collapses)
+            {
+                if (removedEstimate >= trianglesToRemove)
+                {
+                    break;
+                }
+
+                if (touched[collapse.Source] or touched[collapse.Target])
+                {
+                    continue;
+                }
+
+                if (Detail::FlipsTriangle(outIndices, points, offsets, triangles, collapse.Source, collapse.Target))
+                {
+                    continue;
+                }
+
+                remap[collapse.Source] = collapse.Target;
+
+                touched[collapse.Source] = true;
+                touched[collapse.Target] = true;
+
+                Detail::Accumulate(quadrics[collapse.Target], quadrics[collapse.Source]);
+
+                resultError = std::max(resultError, collapse.Cost);
+
+                removedEstimate += 2;
+            }
+
+            if (removedEstimate == 0)
+            {
+                break;
+            }
+
+            Types::UI64 write = 0;
+
+            for (Types::UI64 triangle = 0; triangle < triangleCount; triangle++)
+            {
+                const Types::UI32 a = remap[outIndices[triangle * 3 + 0]];
+                const Types::UI32 b = remap[outIndices[triangle * 3 + 1]];
+                const Types::UI32 c = remap[outIndices[triangle * 3 + 2]];
+
+                if (a == b or b == c or a == c)
+                {
+                    continue;
+                }
+
+                outIndices[write++] = a;
+                outIndices[write++] = b;
+                outIndices[write++] = c;
+            }
+
+            outIndices.resize(write);
+        }
+
+        return static_cast<Types::F32>(std::sqrt(resultError));
+    }
+}
@@ -0,0 +1,383 @@
+#include "rendering/vulkan/barriers.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+
+namespace Mosaic::Internal::Rendering
+{
+    VulkanResourceState VulkanBarrierPlanner::GetState(RenderResourceUsage usage, bool write)
+    {
+        using Stage = vk::PipelineStageFlagBits2;
+        using Access = vk::AccessFlagBits2;
+
+        switch (usage)
+        {
+            case (RenderResourceUsage::ColourAttachment):
+            {
+                return {Stage::eColorAttachmentOutput, write ? Access::eColorAttachmentWrite | Access::eColorAttachmentRead : Access::eColorAttachmentRead, vk::ImageLayout::eColorAttachmentOptimal};
+            }
+            case (RenderResourceUsage::DepthStencilAttachment):
+            {
+                if (write)
+                {
+                    return {Stage::eEarlyFragmentTests | Stage::eLateFragmentTests, Access::eDepthStencilAttachmentWrite | Access::eDepthStencilAttachmentRead, vk::ImageLayout::eDepthStencilAttachmentOptimal};
+                }
+
+                return {Stage::eEarlyFragmentTests | Stage::eLateFragmentTests, Access::eDepthStencilAttachmentRead, vk::ImageLayout::eDepthStencilReadOnlyOptimal};
+            }
+            case (RenderResourceUsage::Sampled):
+            {
+                return {Stage::eFragmentShader | Stage::eComputeShader, Access::eShaderSampledRead, vk::ImageLayout::eShaderReadOnlyOptimal};
+            }
+            case (RenderResourceUsage::Storage):
+            {
+                return {Stage::eFragmentShader | Stage::eComputeShader, write ? Access::eShaderStorageWrite | Access::eShaderStorageRead : Access::eShaderStorageRead, vk::ImageLayout::eGeneral};
+            }
+            case (RenderResourceUsage::TransferSource):
+            {
+                return {Stage::eTransfer, Access::eTransferRead, vk::ImageLayout::eTransferSrcOptimal};
+            }
+            case (RenderResourceUsage::TransferDestination):
+            {
+                return {Stage::eTransfer, Access::eTransferWrite, vk::ImageLayout::eTransferDstOptimal};
+            }
+            case (RenderResourceUsage::Present):
+            {
+                return {Stage::eNone, Access::eNone, vk::ImageLayout::ePresentSrcKHR};
+            }
+        }
+
+        return {Stage::eAllCommands, Access::eMemoryRead | Access::eMemoryWrite, vk::ImageLayout::eGeneral};
+    }
+
+    void VulkanBarrierPlanner::SetInitialState(Types::UI32 resource, const VulkanResourceState& state)
+    {
+        if (resource >= mInitialStates.size())
+        {
+            mInitialStates.resize(resource + 1);
+        }
+
+        mInitialStates[resource] = state;
+    }
+
+    void VulkanBarrierPlanner::SetFinalState(Types::UI32 resource, const VulkanResourceState& state)
+    {
+        if (resource >= mFinalStates.size())
+        {
+            mFinalStates.resize(resource + 1);
+        }
+
+        mFinalStates[resource] = state;
+    }
+
+    void VulkanBarrierPlanner::Plan(const LocalRenderGraph& graph, const CompiledRenderGraph& compiled, std::span<const VulkanPassQueue> queues)
+    {
+        struct MergedAccess
+        {
+            Types::UI32 Resource;
+
+            VulkanResourceState State;
+
+            bool Write;
+        };
+
+        const std::vector<RenderGraphPass>& passes = graph.GetPasses();
+        const std::vector<RenderGraphResource>& resources = graph.GetResources();
+
+        mStatistics = {};
+
+        mPassBarriers.assign(compiled.Order.size(), {});
+        mReleaseBarriers.assign(compiled.Order.size(), {});
+        mFinalBarriers.clear();
+
+        mInitialStates.resize(resources.size());
+        mFinalStates.resize(resources.size());
+        mAspects.resize(resources.size());
+        mBuffers.resize(resources.size());
+
+        std::vector<TrackedState> tracked(resources.size());
+
+        for (Types::UI32 resource = 0; resource < resources.size(); resource++)
+        {
+            mAspects[resource] = GetAspect(resources[resource].Descriptor);
+            mBuffers[resource] = resources[resource].Descriptor.Type == RenderResourceType::Buffer;
+
+            if (mInitialStates[resource])
+            {
+                tracked[resource].Writer = *mInitialStates[resource];
+                tracked[resource].Layout = mInitialStates[resource]->Layout;
+            }
+        }
+
+        std::vector<MergedAccess> merged;
+
+        for (Types::UI32 position = 0; position < compiled.Order.size(); position++)
+        {
+            merged.clear();
+
+            for (const RenderGraphAccess& access : passes[compiled.Order[position]].Accesses)
+            {
+                const VulkanResourceState state = GetState(access.Usage, access.Write);
+
+                auto found = std::ranges::find(merged, access.Resource, &MergedAccess::Resource);
+
+                if (found == merged.end())
+                {
+                    merged.push_back({access.Resource, state, access.Write});
+
+                    continue;
+                }
+
+                found->State.Stages |= state.Stages;
+                found->State.Access |= state.Access;
+                found->Write = found->Write or access.Write;
+
+                if (found->State.Layout != state.Layout)
+                {
+                    found->State.Layout = vk::ImageLayout::eGeneral;
+                }
+            }
+
+            for (const MergedAccess& access : merged)
+            {
+                TrackedState& state = tracked[access.Resource];
+
+                if (compiled.Lifetimes[access.Resource].FirstPass == position and compiled.Offsets[access.Resource] != CompiledRenderGraph::NotAliased)
+                {
+                    for (Types::UI32 other = 0; other < resources.size(); other++)
+                    {
+                        if (compiled.Lifetimes[other].LastPass < position and graph.SharesMemory(access.Resource, other))
+                        {
+                            state.Writer.Stages |= tracked[other].Writer.Stages | tracked[other].Readers.Stages;
+                            state.Writer.Access |= tracked[other].Writer.Access;
+                        }
+                    }
+
+                    state.Layout = vk::ImageLayout::eUndefined;
+                }
+
+                const bool buffer = mBuffers[access.Resource];
+                const bool preserved = buffer ? static_cast<bool>(state.Writer.Stages) : state.Layout != vk::ImageLayout::eUndefined;
+
+                const Types::UI32 previousFamily = state.Family;
+                const Types::UI32 previousPosition = state.LastPosition;
+
+                VulkanResourceState destination = access.State;
+                VulkanResourceState source;
+
+                if (not queues.empty())
+                {
+                    destination.Stages &= queues[position].Stages;
+
+                    state.Family = queues[position].Family;
+                    state.LastPosition = position;
+                }
+
+                const bool required = Transition(state, destination, access.Write, buffer, source);
+
+                if (preserved and previousFamily != VK_QUEUE_FAMILY_IGNORED and previousFamily != state.Family)
+                {
+                    source.Stages &= queues[previousPosition].Stages;
+
+                    mReleaseBarriers[previousPosition].push_back({access.Resource, source, {{}, {}, destination.Layout}, previousFamily, state.Family});
+                    mPassBarriers[position].push_back({access.Resource, {{}, {}, source.Layout}, destination, previousFamily, state.Family});
+
+                    mStatistics.OwnershipTransfers++;
+
+                    continue;
+                }
+
+                if (not required)
+                {
+                    mStatistics.ElidedBarriers++;
+
+                    continue;
+                }
+
+                if (not queues.empty())
+                {
+                    source.Stages &= queues[position].Stages;
+                }
+
+                mPassBarriers[position].push_back({access.Resource, source, destination});
+            }
+        }
+
+        for (Types::UI32 resource = 0; resource < resources.size(); resource++)
+        {
+            VulkanResourceState source;
+
+            if (mFinalStates[resource] and Transition(tracked[resource], *mFinalStates[resource], false, mBuffers[resource], source))
+            {
+                mFinalBarriers.push_back({resource, source, *mFinalStates[resource]});
+            }
+        }
+
+        auto count = [&](const std::vector<VulkanPlannedBarrier>& barriers)
+        {
+            mStatistics.Batches += not barriers.empty();
+            mStatistics.Barriers += barriers.size();
+
+            for (const VulkanPlannedBarrier& barrier : barriers)
+            {
+                mStatistics.LayoutTransitions += not mBuffers[barrier.Resource] and barrier.Source.Layout != barrier.Destination.Layout;
+            }
+        };
+
+        for (Types::UI32 position = 0; position < mPassBarriers.size(); position++)
+        {
+            count(mPassBarriers[position]);
+            count(mReleaseBarriers[position]);
+        }
+
+        count(mFinalBarriers);
+    }
+
+    void VulkanBarrierPlanner::RecordPass(vk::CommandBuffer commandBuffer, Types::UI32 position, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const
+    {
+        Record(commandBuffer, GetPassBarriers(position), images, buffers);
+    }
+
+    void VulkanBarrierPlanner::RecordRelease(vk::CommandBuffer commandBuffer, Types::UI32 position, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const
+    {
+        if (position < mReleaseBarriers.size())
+        {
+            Record(commandBuffer, mReleaseBarriers[position], images, buffers);
+        }
+    }
+
+    void VulkanBarrierPlanner::RecordFinal(vk::CommandBuffer commandBuffer, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const
+    {
+        Record(commandBuffer, mFinalBarriers, images, buffers);
+    }
+
+    const std::vector<VulkanPlannedBarrier>& VulkanBarrierPlanner::GetPassBarriers(Types::UI32 position) const
+    {
+        if (position >= mPassBarriers.size())
+        {
+            Console::Throw("Barriers for pass position {} were not planned ({} available)", position, mPassBarriers.size());
+
+            throw;
+        }
+
+        return mPassBarriers[position];
+    }
+
+    const std::vector<VulkanPlannedBarrier>& VulkanBarrierPlanner::GetFinalBarriers() const
+    {
+        return mFinalBarriers;
+    }
+
+    const VulkanBarrierStatistics& VulkanBarrierPlanner::GetStatistics() const
+    {
+        return mStatistics;
+    }
+
+    vk::ImageAspectFlags VulkanBarrierPlanner::GetAspect(const RenderResourceDescriptor& descriptor)
+    {
+        switch (static_cast<vk::Format>(descriptor.Format))
+        {
+            case (vk::Format::eD16Unorm):
+            case (vk::Format::eX8D24UnormPack32):
+            case (vk::Format::eD32Sfloat):
+            {
+                return vk::ImageAspectFlagBits::eDepth;
+            }
+            case (vk::Format::eD16UnormS8Uint):
+            case (vk::Format::eD24UnormS8Uint):
+            case (vk::Format::eD32SfloatS8Uint):
+            {
+                return vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil;
+            }
+            case (vk::Format::eS8Uint):
+            {
+                return vk::ImageAspectFlagBits::eStencil;
+            }
+            default:
+            {
+                return vk::ImageAspectFlagBits::eColor;
+            }
+        }
+    }
+
+    bool VulkanBarrierPlanner::Transition(TrackedState& tracked, const VulkanResourceState& destination, bool write, bool buffer, VulkanResourceState& source)
+    {
+        const bool layoutChange = not buffer and tracked.Layout != destination.Layout;
+
+        source = {tracked.Writer.Stages, tracked.Writer.Access, tracked.Layout};
+
+        bool required = layoutChange;
+
+        if (write or layoutChange)
+        {
+            source.Stages |= tracked.Readers.Stages;
+
+            required = required or static_cast<bool>(source.Stages);
+
+            tracked.Writer = {destination.Stages, write ? destination.Access : vk::AccessFlags2{}, destination.Layout};
+            tracked.Readers = write ? VulkanResourceState{} : destination;
+        }
+        else
+        {
+            const bool visible = not (destination.Stages & ~tracked.Readers.Stages) and not (destination.Access & ~tracked.Readers.Access);
+
+            required = static_cast<bool>(tracked.Writer.Stages) and not visible;
+
+            tracked.Readers.Stages |= destination.Stages;
+            tracked.Readers.Access |= destination.Access;
+        }
+
+        if (not buffer)
+        {
+            tracked.Layout = destination.Layout;
+        }
+
+        return required;
+    }
+
+    void VulkanBarrierPlanner::Record(vk::CommandBuffer commandBuffer, const std::vector<VulkanPlannedBarrier>& barriers, std::span<const vk::Image> images, std::span<const vk::Buffer> buffers) const
+    {
+        if (barriers.empty())
+        {
+            return;
+        }
+
+        std::vector<vk::ImageMemoryBarrier2> imageBarriers;
+        std::vector<vk::BufferMemoryBarrier2> bufferBarriers;
+
+        for (const VulkanPlannedBarrier& barrier : barriers)
+        {
+            const VulkanResourceState& source = barrier.Source;
+            const VulkanResourceState& destination = barrier.Destination;
+
+            if (mBuffers[barrier.Resource])
+            {
+                if (barrier.Resource >= buffers.size())
+                {
+                    Console::Throw("No vk::Buffer bound for render graph resource {}", barrier.Resource);
+                }
+
+                bufferBarriers.push_back({source.Stages, source.Access, destination.Stages, destination.Access, barrier.SourceFamily, barrier.DestinationFamily, buffers[barrier.Resource], 0, VK_WHOLE_SIZE});
+
+                continue;
+            }
+
+            if (barrier.Resource >= images.size())
+            {
+                Console::Throw("No vk::Image bound for render graph resource {}", barrier.Resource);
+            }
+
+            vk::ImageSubresourceRange range = {mAspects[barrier.Resource], 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+
+            imageBarriers.push_back({source.Stages, source.Access, destination.Stages, destination.Access, source.Layout, destination.Layout, barrier.SourceFamily, barrier.DestinationFamily, images[barrier.Resource], range});
+        }
+
+        vk::DependencyInfo dependencyInfo{};
+
+        dependencyInfo.setBufferMemoryBarriers(bufferBarriers);
+        dependencyInfo.setImageMemoryBarriers(imageBarriers);
+
+        commandBuffer.pipelineBarrier2(dependencyInfo);
+    }
+}
@@ -1,70 +1,163 @@
 #include "rendering/vulkan/commands.hpp"
+#include "rendering/vulkan/barriers.hpp"
 #include "rendering/vulkan/devices.hpp"
 #include "rendering/vulkan/queues.hpp"
+#include "rendering/vulkan/scheduler.hpp"
 #include "rendering/vulkan/swapchain.hpp"
 
+#include <algorithm>
+
 namespace Mosaic::Internal::Rendering
 {
-    void VulkanCommandSystem::Create(VulkanDevice& device, VulkanQueues& queues)
+    void VulkanCommandSystem::Create(VulkanDevice& device, VulkanQueues& queues, const VulkanQueueScheduler& scheduler, Types::UI32 frameCount, Types::UI32 threadCount)
     {
-        vk::CommandPoolCreateInfo poolCreateInfo{vk::CommandPoolCreateFlagBits::eResetCommandBuffer, queues.GetGraphicsQueueFamily()};
+        Reset();
 
-        mCommandPool = device.Get().createCommandPoolUnique(poolCreateInfo);
-    }
+        mDevice = device.Get();
+        mFrames.resize(frameCount);
 
-    void VulkanCommandSystem::AllocateCommandBuffers(VulkanDevice& device, VulkanSwapchain& swapchain)
-    {
-        vk::CommandBufferAllocateInfo allocInfo{mCommandPool.get(), vk::CommandBufferLevel::ePrimary, swapchain.GetImageCount()};
+        for (VulkanCommandFrame& frame : mFrames)
+        {
+            frame.Pools.resize(std::max(threadCount, 1u));
+            frame.Secondaries.resize(frame.Pools.size());
+            frame.SecondaryCounts.resize(frame.Pools.size());
+
+            for (auto& pools : frame.Pools)
+            {
+                for (Types::UI32 index = 0; index < pools.size(); index++)
+                {
+                    const VulkanQueueType type = static_cast<VulkanQueueType>(index);
 
-        mCommandBuffers = device.Get().allocateCommandBuffersUnique(allocInfo);
+                    if (queues.Resolve(type) != type)
+                    {
+                        continue;
+                    }
+
+                    vk::CommandPoolCreateInfo poolCreateInfo{vk::CommandPoolCreateFlagBits::eTransient, queues.GetQueueFamily(type)};
+
+                    pools[index] = mDevice.createCommandPoolUnique(poolCreateInfo);
+                }
+            }
+
+            for (const VulkanQueueBatch& batch : scheduler.GetBatches())
+            {
+                vk::CommandBufferAllocateInfo allocInfo{frame.Pools.front()[static_cast<Types::UI32>(batch.Queue)].get(), vk::CommandBufferLevel::ePrimary, 1};
+
+                frame.CommandBuffers.push_back(mDevice.allocateCommandBuffers(allocInfo).front());
+            }
+        }
     }
 
-    void VulkanCommandSystem::BeginFrame(Types::UI32 imageIndex)
+    void VulkanCommandSystem::BeginFrame(Types::UI32 frame)
     {
-        auto& commandBuffer = mCommandBuffers[imageIndex];
+        VulkanCommandFrame& commands = mFrames[frame];
 
-        vk::CommandBufferBeginInfo beginInfo{vk::CommandBufferUsageFlagBits::eSimultaneousUse, nullptr};
+        for (const auto& pools : commands.Pools)
+        {
+            for (const auto& pool : pools)
+            {
+                if (pool)
+                {
+                    mDevice.resetCommandPool(pool.get());
+                }
+            }
+        }
+
+        std::ranges::fill(commands.SecondaryCounts, 0);
 
-        commandBuffer->begin(beginInfo);
+        vk::CommandBufferBeginInfo beginInfo{vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr};
+
+        for (vk::CommandBuffer commandBuffer : commands.CommandBuffers)
+        {
+            commandBuffer.begin(beginInfo);
+        }
     }
 
-    void VulkanCommandSystem::EndFrame(Types::UI32 imageIndex)
+    void VulkanCommandSystem::EndFrame(Types::UI32 frame)
     {
-        auto& commandBuffer = mCommandBuffers[imageIndex];
-
-        commandBuffer->end();
+        for (vk::CommandBuffer commandBuffer : mFrames[frame].CommandBuffers)
+        {
+            commandBuffer.end();
+        }
     }
 
-    void VulkanCommandSystem::RecordCommands(VulkanRenderPass& renderPass, VulkanFramebuffer& framebuffer, VulkanSwapchain& swapchain, Types::UI32 imageIndex, const Types::Vec4<Types::F32>& clear)
+    void VulkanCommandSystem::RecordCommands(VulkanRenderPass& renderPass, VulkanFramebuffer& framebuffer, VulkanSwapchain& swapchain, const VulkanBarrierPlanner& barriers, const VulkanQueueScheduler& scheduler, std::span<const vk::Image> images, Types::UI32 frame, Types::UI32 passPosition, const Types::Vec4<Types::F32>& clear, const VulkanDrawList& draws)
     {
-        auto& commandBuffer = mCommandBuffers[imageIndex];
+        const std::vector<VulkanQueueBatch>& batches = scheduler.GetBatches();
 
         vk::ClearValue clearColour = vk::ClearColorValue(std::array{clear.X, clear.Y, clear.Z, clear.W});
 
         vk::RenderPassBeginInfo renderPassBeginInfo{renderPass.GetRenderPass(), framebuffer.GetFramebuffer(), vk::Rect2D({0, 0}, swapchain.GetExtent()), 1, &clearColour};
 
-        commandBuffer->beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
-        commandBuffer->endRenderPass();
+        for (Types::UI32 batch = 0; batch < batches.size(); batch++)
+        {
+            vk::CommandBuffer commandBuffer = mFrames[frame].CommandBuffers[batch];
+
+            for (Types::UI32 position = batches[batch].FirstPosition; position < batches[batch].FirstPosition + batches[batch].PositionCount; position++)
+            {
+                barriers.RecordPass(commandBuffer, position, images, {});
+
+                if (position == passPosition and draws.Count > 0 and draws.Record)
+                {
+                    RecordParallel(commandBuffer, frame, renderPassBeginInfo, draws.Count, draws.GrainSize, draws.Record);
+                }
+                else if (position == passPosition)
+                {
+                    commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+                    commandBuffer.endRenderPass();
+                }
+
+                barriers.RecordRelease(commandBuffer, position, images, {});
+            }
+
+            if (batch == scheduler.GetLastBatch(VulkanQueueType::Graphics))
+            {
+                barriers.RecordFinal(commandBuffer, images, {});
+            }
+        }
     }
 
-    vk::CommandBuffer& VulkanCommandSystem::GetCommandBuffer(Types::UI32 imageIndex)
+    vk::CommandBuffer VulkanCommandSystem::AcquireSecondary(Types::UI32 frame, Types::UI32 thread)
     {
-        return *mCommandBuffers[imageIndex];
+        VulkanCommandFrame& commands = mFrames[frame];
+
+        std::vector<vk::CommandBuffer>& secondaries = commands.Secondaries[thread];
+        Types::UI32& used = commands.SecondaryCounts[thread];
+
+        if (used == secondaries.size())
+        {
+            const auto& pool = commands.Pools[thread][static_cast<Types::UI32>(VulkanQueueType::Graphics)];
+
+            vk::CommandBufferAllocateInfo allocInfo{pool.get(), vk::CommandBufferLevel::eSecondary, 1};
+
+            secondaries.push_back(mDevice.allocateCommandBuffers(allocInfo).front());
+        }
+
+        return secondaries[used++];
     }
 
-    void VulkanCommandSystem::SubmitFrame(vk::Queue graphicsQueue, const VulkanFrameSubmitDescriptor& info)
+    vk::CommandBuffer VulkanCommandSystem::GetCommandBuffer(Types::UI32 frame, Types::UI32 batch) const
     {
-        vk::SubmitInfo submitInfo{1, &info.WaitSemaphore, &info.WaitStage, 1, &info.Command, 1, &info.SignalSemaphore};
+        return mFrames[frame].CommandBuffers[batch];
+    }
 
-        graphicsQueue.submit(submitInfo, info.InFlightFence);
+    vk::CommandPool VulkanCommandSystem::GetCommandPool(Types::UI32 frame, Types::UI32 thread, Types::UI32 queue) const
+    {
+        return mFrames[frame].Pools[thread][queue].get();
+    }
+
+    Types::UI32 VulkanCommandSystem::GetFrameCount() const
+    {
+        return mFrames.size();
+    }
+
+    Types::UI32 VulkanCommandSystem::GetThreadCount() const
+    {
+        return mFrames.empty() ? 0 : mFrames.front().Pools.size();
     }
 
     void VulkanCommandSystem::Reset()
     {
-        if (mCommandPool)
-        {
-            mCommandBuffers.clear();
-            mCommandPool.reset();
-        }
+        mFrames.clear();
     }
 }
\ No newline at end of file
@@ -112,6 +112,16 @@ namespace Mosaic::Internal::Rendering
 
         physicalDevice.Get().getFeatures2(&enabledFeatures);
 
+        if (not enabled13.synchronization2)
+        {
+            Console::Throw("vk::PhysicalDevice does not support synchronization2");
+        }
+
+        if (not enabled12.timelineSemaphore)
+        {
+            Console::Throw("vk::PhysicalDevice does not support timeline semaphores");
+        }
+
         deviceCreateInfo.pNext = &enabledFeatures;
 
         mDevice = physicalDevice.Get().createDeviceUnique(deviceCreateInfo);
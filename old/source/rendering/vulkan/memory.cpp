@@ -0,0 +1,332 @@
+#include "rendering/vulkan/memory.hpp"
+#include "rendering/vulkan/devices.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace Mosaic::Internal::Rendering
+{
+    void VulkanMemoryAllocator::Create(VulkanPhysicalDevice& physicalDevice, VulkanDevice& device, vk::DeviceSize blockSize)
+    {
+        Reset();
+
+        const vk::PhysicalDeviceLimits limits = physicalDevice.Get().getProperties().limits;
+
+        mDevice = device.Get();
+        mMemoryProperties = physicalDevice.Get().getMemoryProperties();
+
+        mMinimumSize = std::bit_ceil(std::max(MinimumAllocationSize, limits.bufferImageGranularity));
+        mBlockSize = std::max(std::bit_ceil(blockSize), mMinimumSize);
+        mMaxOrder = std::countr_zero(mBlockSize / mMinimumSize);
+        mMaxAllocations = limits.maxMemoryAllocationCount;
+    }
+
+    void VulkanMemoryAllocator::Reset()
+    {
+        std::lock_guard lock(mMutex);
+
+        mBlocks.clear();
+        mDedicated.clear();
+
+        mStatistics = {};
+    }
+
+    VulkanAllocation VulkanMemoryAllocator::Allocate(const vk::MemoryRequirements& requirements, VulkanMemoryUsage usage, bool dedicated)
+    {
+        const Types::UI32 memoryType = FindMemoryType(requirements.memoryTypeBits, usage);
+
+        std::lock_guard lock(mMutex);
+
+        if (dedicated or std::max(requirements.size, requirements.alignment) > mBlockSize / 2)
+        {
+            return AllocateDedicated(requirements.size, memoryType, nullptr);
+        }
+
+        return AllocateFromBlocks(std::max(requirements.size, requirements.alignment), memoryType);
+    }
+
+    void VulkanMemoryAllocator::Free(VulkanAllocation& allocation)
+    {
+        if (not allocation.Memory)
+        {
+            return;
+        }
+
+        std::lock_guard lock(mMutex);
+
+        mStatistics.AllocationCount--;
+
+        if (allocation.Block == VulkanAllocation::Dedicated)
+        {
+            auto found = std::ranges::find_if(mDedicated, [&](const vk::UniqueDeviceMemory& memory)
+                                              { return memory.get() == allocation.Memory; });
+
+            if (found != mDedicated.end())
+            {
+                mDedicated.erase(found);
+            }
+
+            mStatistics.DedicatedCount--;
+            mStatistics.ReservedBytes -= allocation.Size;
+            mStatistics.UsedBytes -= allocation.Size;
+
+            allocation = {};
+
+            return;
+        }
+
+        Block& block = *mBlocks[allocation.Block];
+
+        vk::DeviceSize offset = allocation.Offset;
+        Types::UI32 order = allocation.Order;
+
+        mStatistics.UsedBytes -= mMinimumSize << order;
+
+        while (order < mMaxOrder)
+        {
+            const vk::DeviceSize buddy = offset ^ (mMinimumSize << order);
+
+            if (block.FreeOffsets[order].erase(buddy) == 0)
+            {
+                break;
+            }
+
+            offset = std::min(offset, buddy);
+            order++;
+        }
+
+        block.FreeOffsets[order].insert(offset);
+
+        allocation = {};
+    }
+
+    vk::UniqueBuffer VulkanMemoryAllocator::CreateBuffer(const vk::BufferCreateInfo& createInfo, VulkanMemoryUsage usage, VulkanAllocation& allocation)
+    {
+        vk::UniqueBuffer buffer = mDevice.createBufferUnique(createInfo);
+
+        const auto requirements = mDevice.getBufferMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>({buffer.get()});
+
+        const vk::MemoryRequirements& memoryRequirements = requirements.get<vk::MemoryRequirements2>().memoryRequirements;
+
+        if (requirements.get<vk::MemoryDedicatedRequirements>().prefersDedicatedAllocation)
+        {
+            const vk::MemoryDedicatedAllocateInfo dedicatedInfo{{}, buffer.get()};
+
+            const Types::UI32 memoryType = FindMemoryType(memoryRequirements.memoryTypeBits, usage);
+
+            std::lock_guard lock(mMutex);
+
+            allocation = AllocateDedicated(memoryRequirements.size, memoryType, &dedicatedInfo);
+        }
+        else
+        {
+            allocation = Allocate(memoryRequirements, usage);
+        }
+
+        mDevice.bindBufferMemory(buffer.get(), allocation.Memory, allocation.Offset);
+
+        return buffer;
+    }
+
+    vk::UniqueImage VulkanMemoryAllocator::CreateImage(const vk::ImageCreateInfo& createInfo, VulkanMemoryUsage usage, VulkanAllocation& allocation)
+    {
+        vk::UniqueImage image = mDevice.createImageUnique(createInfo);
+
+        const auto requirements = mDevice.getImageMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>({image.get()});
+
+        const vk::MemoryRequirements& memoryRequirements = requirements.get<vk::MemoryRequirements2>().memoryRequirements;
+
+        if (requirements.get<vk::MemoryDedicatedRequirements>().prefersDedicatedAllocation)
+        {
+            const vk::MemoryDedicatedAllocateInfo dedicatedInfo{image.get(), {}};
+
+            const Types::UI32 memoryType = FindMemoryType(memoryRequirements.memoryTypeBits, usage);
+
+            std::lock_guard lock(mMutex);
+
+            allocation = AllocateDedicated(memoryRequirements.size, memoryType, &dedicatedInfo);
+        }
+        else
+        {
+            allocation = Allocate(memoryRequirements, usage);
+        }
+
+        mDevice.bindImageMemory(image.get(), allocation.Memory, allocation.Offset);
+
+        return image;
+    }
+
+    VulkanMemoryStatistics VulkanMemoryAllocator::GetStatistics() const
+    {
+        std::lock_guard lock(mMutex);
+
+        return mStatistics;
+    }
+
+    Types::UI32 VulkanMemoryAllocator::FindMemoryType(Types::UI32 typeBits, VulkanMemoryUsage usage) const
+    {
+        using Property = vk::MemoryPropertyFlagBits;
+
+        vk::MemoryPropertyFlags required;
+        vk::MemoryPropertyFlags preferred;
+
+        switch (usage)
+        {
+            case (VulkanMemoryUsage::DeviceLocal):
+            {
+                required = Property::eDeviceLocal;
+                break;
+            }
+            case (VulkanMemoryUsage::Upload):
+            {
+                required = Property::eHostVisible | Property::eHostCoherent;
+                preferred = Property::eDeviceLocal;
+                break;
+            }
+            case (VulkanMemoryUsage::Readback):
+            {
+                required = Property::eHostVisible;
+                preferred = Property::eHostCached | Property::eHostCoherent;
+                break;
+            }
+        }
+
+        for (vk::MemoryPropertyFlags flags : {required | preferred, required})
+        {
+            for (Types::UI32 index = 0; index < mMemoryProperties.memoryTypeCount; index++)
+            {
+                if ((typeBits & (1u << index)) and (mMemoryProperties.memoryTypes[index].propertyFlags & flags) == flags)
+                {
+                    return index;
+                }
+            }
+        }
+
+        Console::Throw("No Vulkan memory type matches type bits {:#x} with properties {}", typeBits, vk::to_string(required));
+
+        throw;
+    }
+
+    VulkanAllocation VulkanMemoryAllocator::AllocateDedicated(vk::DeviceSize size, Types::UI32 memoryType, const void* next)
+    {
+        VulkanAllocation allocation;
+
+        vk::UniqueDeviceMemory memory = AllocateMemory(size, memoryType, next, allocation.Mapped);
+
+        allocation.Memory = memory.get();
+        allocation.Size = size;
+        allocation.MemoryType = memoryType;
+
+        mDedicated.push_back(std::move(memory));
+
+        mStatistics.DedicatedCount++;
+        mStatistics.AllocationCount++;
+        mStatistics.ReservedBytes += size;
+        mStatistics.UsedBytes += size;
+
+        return allocation;
+    }
+
+    VulkanAllocation VulkanMemoryAllocator::AllocateFromBlocks(vk::DeviceSize size, Types::UI32 memoryType)
+    {
+        const Types::UI32 order = GetOrder(size);
+
+        Types::UI32 blockIndex = VulkanAllocation::Dedicated;
+        Types::UI32 found = mMaxOrder + 1;
+
+        for (Types::UI32 index = 0; index < mBlocks.size() and found != order; index++)
+        {
+            const Block& block = *mBlocks[index];
+
+            if (block.MemoryType != memoryType)
+            {
+                continue;
+            }
+
+            for (Types::UI32 candidate = order; candidate < found; candidate++)
+            {
+                if (not block.FreeOffsets[candidate].empty())
+                {
+                    blockIndex = index;
+                    found = candidate;
+
+                    break;
+                }
+            }
+        }
+
+        if (blockIndex == VulkanAllocation::Dedicated)
+        {
+            auto block = std::make_unique<Block>();
+
+            block->Memory = AllocateMemory(mBlockSize, memoryType, nullptr, block->Mapped);
+            block->MemoryType = memoryType;
+            block->FreeOffsets.resize(mMaxOrder + 1);
+            block->FreeOffsets[mMaxOrder].insert(0);
+
+            mBlocks.push_back(std::move(block));
+
+            mStatistics.BlockCount++;
+            mStatistics.ReservedBytes += mBlockSize;
+
+            blockIndex = mBlocks.size() - 1;
+            found = mMaxOrder;
+        }
+
+        Block& block = *mBlocks[blockIndex];
+
+        const vk::DeviceSize offset = *block.FreeOffsets[found].begin();
+
+        block.FreeOffsets[found].erase(block.FreeOffsets[found].begin());
+
+        while (found > order)
+        {
+            found--;
+
+            block.FreeOffsets[found].insert(offset + (mMinimumSize << found));
+        }
+
+        VulkanAllocation allocation;
+
+        allocation.Memory = block.Memory.get();
+        allocation.Offset = offset;
+        allocation.Size = size;
+        allocation.Mapped = block.Mapped ? block.Mapped + offset : nullptr;
+        allocation.MemoryType = memoryType;
+        allocation.Block = blockIndex;
+        allocation.Order = order;
+
+        mStatistics.AllocationCount++;
+        mStatistics.UsedBytes += mMinimumSize << order;
+
+        return allocation;
+    }
+
+    vk::UniqueDeviceMemory VulkanMemoryAllocator::AllocateMemory(vk::DeviceSize size, Types::UI32 memoryType, const void* next, std::byte*& mapped)
+    {
+        if (mStatistics.BlockCount + mStatistics.DedicatedCount >= mMaxAllocations)
+        {
+            Console::Throw("Vulkan memory allocation limit of {} reached", mMaxAllocations);
+        }
+
+        vk::MemoryAllocateInfo allocateInfo{size, memoryType, next};
+
+        vk::UniqueDeviceMemory memory = mDevice.allocateMemoryUnique(allocateInfo);
+
+        mapped = nullptr;
+
+        if (mMemoryProperties.memoryTypes[memoryType].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible)
+        {
+            mapped = static_cast<std::byte*>(mDevice.mapMemory(memory.get(), 0, VK_WHOLE_SIZE));
+        }
+
+        return memory;
+    }
+
+    Types::UI32 VulkanMemoryAllocator::GetOrder(vk::DeviceSize size) const
+    {
+        return std::countr_zero(std::bit_ceil(std::max(size, mMinimumSize)) / mMinimumSize);
+    }
+}
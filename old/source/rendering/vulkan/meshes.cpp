@@ -0,0 +1,195 @@
+#include "rendering/vulkan/meshes.hpp"
+#include "rendering/vulkan/queues.hpp"
+#include "rendering/vulkan/staging.hpp"
+
+#include "rendering/renderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Mosaic::Internal::Rendering
+{
+    void VulkanMeshCache::Create(const VulkanQueues& queues, VulkanMemoryAllocator& memory, VulkanStagingRing& staging)
+    {
+        Reset();
+
+        mMemory = &memory;
+        mStaging = &staging;
+
+        mFamilies = {queues.GetGraphicsQueueFamily()};
+
+        if (queues.GetTransferQueueFamily() != queues.GetGraphicsQueueFamily())
+        {
+            mFamilies.push_back(queues.GetTransferQueueFamily());
+        }
+    }
+
+    void VulkanMeshCache::Reset()
+    {
+        for (auto& [mesh, buffers] : mMeshes)
+        {
+            Release(buffers);
+        }
+
+        for (auto& [frame, buffers] : mRetired)
+        {
+            Release(buffers);
+        }
+
+        mMeshes.clear();
+        mRetired.clear();
+
+        mTransferWait = 0;
+    }
+
+    void VulkanMeshCache::Apply(const RendererMeshUpload& upload)
+    {
+        auto [iterator, inserted] = mMeshes.try_emplace(upload.Mesh);
+
+        VulkanMeshBuffers& buffers = iterator->second;
+
+        if (buffers.Generation != upload.Generation)
+        {
+            if (not inserted)
+            {
+                mRetired.emplace_back(mFrame + RetireFrames, std::move(buffers));
+
+                buffers = {};
+            }
+
+            CreateBuffers(upload, buffers);
+        }
+        else if (not upload.Writes.empty())
+        {
+            mTransferWait = std::max(mTransferWait, buffers.LastRead);
+        }
+
+        for (const RendererMeshWrite& write : upload.Writes)
+        {
+            const bool indices = write.Stream == RendererMeshUpload::IndexStream;
+
+            if (not indices and write.Stream >= buffers.Streams.size())
+            {
+                continue;
+            }
+
+            const vk::Buffer destination = indices ? buffers.Indices.get() : buffers.Streams[write.Stream].get();
+
+            if (destination)
+            {
+                buffers.Resident = mStaging->Upload(write.Data, destination, write.OffsetBytes);
+            }
+        }
+    }
+
+    const VulkanMeshBuffers* VulkanMeshCache::Find(Types::UI64 mesh) const
+    {
+        auto found = mMeshes.find(mesh);
+
+        return found == mMeshes.end() ? nullptr : &found->second;
+    }
+
+    bool VulkanMeshCache::IsResident(Types::UI64 mesh) const
+    {
+        auto found = mMeshes.find(mesh);
+
+        if (found == mMeshes.end() or not found->second.Resident.valid())
+        {
+            return false;
+        }
+
+        return found->second.Resident.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    void VulkanMeshCache::MarkRead(Types::UI64 mesh, Types::UI64 value)
+    {
+        auto found = mMeshes.find(mesh);
+
+        if (found != mMeshes.end())
+        {
+            found->second.LastRead = value;
+        }
+    }
+
+    Types::UI64 VulkanMeshCache::GetTransferWait() const
+    {
+        return mTransferWait;
+    }
+
+    void VulkanMeshCache::Evict(std::span<const Types::UI64> meshes)
+    {
+        for (Types::UI64 mesh : meshes)
+        {
+            auto found = mMeshes.find(mesh);
+
+            if (found == mMeshes.end())
+            {
+                continue;
+            }
+
+            mRetired.emplace_back(mFrame + RetireFrames, std::move(found->second));
+
+            mMeshes.erase(found);
+        }
+    }
+
+    void VulkanMeshCache::EndFrame()
+    {
+        mFrame++;
+
+        std::erase_if(mRetired, [&](auto& retired)
+                      {
+                          if (retired.first > mFrame)
+                          {
+                              return false;
+                          }
+
+                          Release(retired.second);
+
+                          return true; });
+    }
+
+    void VulkanMeshCache::CreateBuffers(const RendererMeshUpload& upload, VulkanMeshBuffers& buffers)
+    {
+        buffers.Generation = upload.Generation;
+
+        buffers.Streams.resize(upload.StreamBytes.size());
+        buffers.StreamAllocations.resize(upload.StreamBytes.size());
+
+        for (Types::UI32 stream = 0; stream < upload.StreamBytes.size(); stream++)
+        {
+            buffers.Streams[stream] = CreateBuffer(upload.StreamBytes[stream], vk::BufferUsageFlagBits::eVertexBuffer, buffers.StreamAllocations[stream]);
+        }
+
+        buffers.Indices = CreateBuffer(upload.IndexBytes, vk::BufferUsageFlagBits::eIndexBuffer, buffers.IndexAllocation);
+    }
+
+    void VulkanMeshCache::Release(VulkanMeshBuffers& buffers)
+    {
+        buffers.Streams.clear();
+        buffers.Indices.reset();
+
+        for (VulkanAllocation& allocation : buffers.StreamAllocations)
+        {
+            mMemory->Free(allocation);
+        }
+
+        mMemory->Free(buffers.IndexAllocation);
+
+        buffers.StreamAllocations.clear();
+    }
+
+    vk::UniqueBuffer VulkanMeshCache::CreateBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage, VulkanAllocation& allocation)
+    {
+        if (size == 0)
+        {
+            return {};
+        }
+
+        const vk::SharingMode sharing = mFamilies.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+
+        vk::BufferCreateInfo bufferInfo{{}, size, usage | vk::BufferUsageFlagBits::eTransferDst, sharing, static_cast<Types::UI32>(mFamilies.size()), mFamilies.data()};
+
+        return mMemory->CreateBuffer(bufferInfo, VulkanMemoryUsage::DeviceLocal, allocation);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,473 @@
+#include "rendering/vulkan/pipelines.hpp"
+#include "rendering/vulkan/devices.hpp"
+#include "rendering/vulkan/swapchain.hpp"
+#include "rendering/vulkan/vertex.hpp"
+
+#include "rendering/mesh.hpp"
+
+#include "application/console.hpp"
+
+#include "utilities/hash.hpp"
+#include "utilities/mappedfile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace Mosaic::Internal::Rendering
+{
+    VulkanPipelineCache::~VulkanPipelineCache()
+    {
+        Reset();
+    }
+
+    void VulkanPipelineCache::Create(VulkanPhysicalDevice& physicalDevice, VulkanDevice& device, const std::string& directory)
+    {
+        Reset();
+
+        const vk::PhysicalDeviceProperties properties = physicalDevice.Get().getProperties();
+
+        mDevice = device.Get();
+
+        mHeader = {};
+        mHeader.Magic = Magic;
+        mHeader.Version = Version;
+        mHeader.VendorID = properties.vendorID;
+        mHeader.DeviceID = properties.deviceID;
+        mHeader.DriverVersion = properties.driverVersion;
+
+        std::ranges::copy(properties.pipelineCacheUUID, mHeader.CacheUUID.begin());
+
+        mPath = (std::filesystem::path(directory) / std::format("pipelines-{:04x}-{:04x}.bin", properties.vendorID, properties.deviceID)).string();
+
+        const std::vector<std::byte> initialData = Load();
+
+        vk::PipelineCacheCreateInfo createInfo{{}, initialData.size(), initialData.data()};
+
+        mCache = mDevice.createPipelineCacheUnique(createInfo);
+
+        mSavedSize = initialData.size();
+        mLastSave = std::chrono::steady_clock::now();
+    }
+
+    void VulkanPipelineCache::Reset()
+    {
+        if (mCache)
+        {
+            Save();
+        }
+
+        mCache.reset();
+        mSavedSize = 0;
+    }
+
+    void VulkanPipelineCache::Update()
+    {
+        if (not mCache or std::chrono::steady_clock::now() - mLastSave < SaveInterval)
+        {
+            return;
+        }
+
+        Save();
+    }
+
+    void VulkanPipelineCache::Save()
+    {
+        mLastSave = std::chrono::steady_clock::now();
+
+        const std::vector<Types::UI8> data = mDevice.getPipelineCacheData(mCache.get());
+
+        if (data.empty() or data.size() == mSavedSize)
+        {
+            return;
+        }
+
+        VulkanPipelineCacheHeader header = mHeader;
+
+        header.DataSize = data.size();
+        header.DataHash = Hashing::FNV1a(std::as_bytes(std::span(data)));
+
+        const std::string temporaryPath = mPath + ".tmp";
+
+        std::error_code error;
+
+        std::filesystem::create_directories(std::filesystem::path(mPath).parent_path(), error);
+
+        {
+            std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(VulkanPipelineCacheHeader));
+            out.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+            if (not out)
+            {
+                Console::LogWarning("Failed to write pipeline cache: {}", temporaryPath);
+
+                return;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, mPath, error);
+
+        if (error)
+        {
+            Console::LogWarning("Failed to replace pipeline cache {}: {}", mPath, error.message());
+
+            return;
+        }
+
+        mSavedSize = data.size();
+    }
+
+    vk::PipelineCache VulkanPipelineCache::Get() const
+    {
+        return mCache.get();
+    }
+
+    const std::string& VulkanPipelineCache::GetPath() const
+    {
+        return mPath;
+    }
+
+    std::vector<std::byte> VulkanPipelineCache::Load() const
+    {
+        std::error_code error;
+
+        if (std::filesystem::file_size(mPath, error) <= sizeof(VulkanPipelineCacheHeader) or error)
+        {
+            return {};
+        }
+
+        Files::MappedFile mapping(mPath);
+
+        const std::span<const std::byte> file = mapping.GetData();
+
+        if (not Validate(file))
+        {
+            Console::LogWarning("Discarding stale or corrupt pipeline cache: {}", mPath);
+
+            return {};
+        }
+
+        const std::span<const std::byte> data = file.subspan(sizeof(VulkanPipelineCacheHeader));
+
+        return {data.begin(), data.end()};
+    }
+
+    bool VulkanPipelineCache::Validate(std::span<const std::byte> file) const
+    {
+        VulkanPipelineCacheHeader header;
+
+        std::memcpy(&header, file.data(), sizeof(VulkanPipelineCacheHeader));
+
+        if (header.Magic != mHeader.Magic or header.Version != mHeader.Version)
+        {
+            return false;
+        }
+
+        if (header.VendorID != mHeader.VendorID or header.DeviceID != mHeader.DeviceID or header.DriverVersion != mHeader.DriverVersion or header.CacheUUID != mHeader.CacheUUID)
+        {
+            return false;
+        }
+
+        const std::span<const std::byte> data = file.subspan(sizeof(VulkanPipelineCacheHeader));
+
+        if (header.DataSize != data.size() or header.DataHash != Hashing::FNV1a(data) or data.size() < sizeof(VkPipelineCacheHeaderVersionOne))
+        {
+            return false;
+        }
+
+        VkPipelineCacheHeaderVersionOne driverHeader;
+
+        std::memcpy(&driverHeader, data.data(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+        return driverHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE and driverHeader.vendorID == mHeader.VendorID and driverHeader.deviceID == mHeader.DeviceID and std::ranges::equal(driverHeader.pipelineCacheUUID, mHeader.CacheUUID);
+    }
+
+    void VulkanPipelineStates::Create(VulkanDevice& device, VulkanPipelineCache& cache, VulkanRenderPass& renderPass)
+    {
+        Reset();
+
+        mDevice = device.Get();
+        mCache = cache.Get();
+        mRenderPass = renderPass.GetRenderPass();
+
+        mLayout = mDevice.createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo{});
+
+        mStates.SetCompiler([this](const PipelineDescriptor& descriptor)
+                            { return Compile(descriptor); });
+    }
+
+    void VulkanPipelineStates::Reset()
+    {
+        mStates.Reset();
+
+        mLayout.reset();
+    }
+
+    vk::Pipeline VulkanPipelineStates::Acquire(const std::shared_ptr<const PipelineSnapshot>& pipeline)
+    {
+        const vk::UniquePipeline* compiled = mStates.Acquire(pipeline);
+
+        return compiled ? compiled->get() : vk::Pipeline{};
+    }
+
+    void VulkanPipelineStates::Prewarm(std::span<const Pipeline> pipelines)
+    {
+        mStates.Prewarm(pipelines);
+    }
+
+    PipelineStateCache<vk::UniquePipeline>& VulkanPipelineStates::GetStates()
+    {
+        return mStates;
+    }
+
+    vk::PipelineLayout VulkanPipelineStates::GetLayout() const
+    {
+        return mLayout.get();
+    }
+
+    vk::UniquePipeline VulkanPipelineStates::Compile(const PipelineDescriptor& descriptor) const
+    {
+        std::vector<vk::UniqueShaderModule> modules;
+        std::vector<vk::PipelineShaderStageCreateInfo> stages;
+
+        for (const Shader* shader : descriptor.Shaders)
+        {
+            if (not shader or shader->GetCode().empty())
+            {
+                Console::Throw("Pipeline shaders must contain SPIR-V code");
+            }
+
+            modules.push_back(mDevice.createShaderModuleUnique({{}, shader->GetCode().size_bytes(), shader->GetCode().data()}));
+            stages.push_back({{}, GetStage(shader->GetStage()), modules.back().get(), shader->GetEntryPoint().c_str()});
+        }
+
+        VulkanVertexInput vertexInput;
+
+        if (descriptor.Format)
+        {
+            vertexInput.Create(descriptor.Format->GetLayoutDescriptor());
+        }
+
+        const vk::PipelineVertexInputStateCreateInfo vertexInputInfo = vertexInput.GetCreateInfo();
+
+        const vk::PipelineInputAssemblyStateCreateInfo inputAssemblyInfo{{}, GetTopology(descriptor.Topology)};
+
+        const vk::PipelineViewportStateCreateInfo viewportInfo{{}, 1, nullptr, 1, nullptr};
+
+        const auto rasterizationInfo = vk::PipelineRasterizationStateCreateInfo{}
+                                           .setPolygonMode(vk::PolygonMode::eFill)
+                                           .setCullMode(GetCullMode(descriptor.Cull))
+                                           .setFrontFace(vk::FrontFace::eCounterClockwise)
+                                           .setLineWidth(1.0f);
+
+        const auto multisampleInfo = vk::PipelineMultisampleStateCreateInfo{}
+                                         .setRasterizationSamples(static_cast<vk::SampleCountFlagBits>(descriptor.SampleCount));
+
+        const auto depthStencilInfo = vk::PipelineDepthStencilStateCreateInfo{}
+                                          .setDepthTestEnable(descriptor.Depth.Test)
+                                          .setDepthWriteEnable(descriptor.Depth.Write)
+                                          .setDepthCompareOp(GetCompareOp(descriptor.Depth.Compare));
+
+        const std::vector<vk::PipelineColorBlendAttachmentState> attachments(std::max<Types::UI64>(descriptor.ColourFormats.size(), 1), GetBlendState(descriptor.Blend));
+
+        const auto colourBlendInfo = vk::PipelineColorBlendStateCreateInfo{}
+                                         .setAttachments(attachments);
+
+        const std::array dynamicStates{vk::DynamicState::eViewport, vk::DynamicState::eScissor};
+
+        const auto dynamicInfo = vk::PipelineDynamicStateCreateInfo{}
+                                     .setDynamicStates(dynamicStates);
+
+        const auto pipelineInfo = vk::GraphicsPipelineCreateInfo{}
+                                      .setStages(stages)
+                                      .setPVertexInputState(&vertexInputInfo)
+                                      .setPInputAssemblyState(&inputAssemblyInfo)
+                                      .setPViewportState(&viewportInfo)
+                                      .setPRasterizationState(&rasterizationInfo)
+                                      .setPMultisampleState(&multisampleInfo)
+                                      .setPDepthStencilState(&depthStencilInfo)
+                                      .setPColorBlendState(&colourBlendInfo)
+                                      .setPDynamicState(&dynamicInfo)
+                                      .setLayout(mLayout.get())
+                                      .setRenderPass(mRenderPass)
+                                      .setSubpass(0);
+
+        auto created = mDevice.createGraphicsPipelineUnique(mCache, pipelineInfo);
+
+        if (created.result != vk::Result::eSuccess)
+        {
+            Console::Throw("Failed to create graphics pipeline: {}", vk::to_string(created.result));
+        }
+
+        return std::move(created.value);
+    }
+
+    vk::ShaderStageFlagBits VulkanPipelineStates::GetStage(ShaderStage stage)
+    {
+        switch (stage)
+        {
+            case (ShaderStage::Vertex):
+            {
+                return vk::ShaderStageFlagBits::eVertex;
+            }
+            case (ShaderStage::Fragment):
+            {
+                return vk::ShaderStageFlagBits::eFragment;
+            }
+            case (ShaderStage::Compute):
+            {
+                return vk::ShaderStageFlagBits::eCompute;
+            }
+        }
+
+        Console::Throw("Unsupported shader stage {}", static_cast<Types::UI32>(stage));
+
+        throw;
+    }
+
+    vk::PrimitiveTopology VulkanPipelineStates::GetTopology(PrimitiveTopology topology)
+    {
+        switch (topology)
+        {
+            case (PrimitiveTopology::Points):
+            {
+                return vk::PrimitiveTopology::ePointList;
+            }
+            case (PrimitiveTopology::Lines):
+            {
+                return vk::PrimitiveTopology::eLineList;
+            }
+            case (PrimitiveTopology::LineStrip):
+            {
+                return vk::PrimitiveTopology::eLineStrip;
+            }
+            case (PrimitiveTopology::Triangles):
+            {
+                return vk::PrimitiveTopology::eTriangleList;
+            }
+            case (PrimitiveTopology::TriangleStrip):
+            {
+                return vk::PrimitiveTopology::eTriangleStrip;
+            }
+        }
+
+        Console::Throw("Unsupported primitive topology {}", static_cast<Types::UI32>(topology));
+
+        throw;
+    }
+
+    vk::CullModeFlags VulkanPipelineStates::GetCullMode(CullMode cull)
+    {
+        switch (cull)
+        {
+            case (CullMode::None):
+            {
+                return vk::CullModeFlagBits::eNone;
+            }
+            case (CullMode::Front):
+            {
+                return vk::CullModeFlagBits::eFront;
+            }
+            case (CullMode::Back):
+            {
+                return vk::CullModeFlagBits::eBack;
+            }
+        }
+
+        Console::Throw("Unsupported cull mode {}", static_cast<Types::UI32>(cull));
+
+        throw;
+    }
+
+    vk::CompareOp VulkanPipelineStates::GetCompareOp(CompareOperation compare)
+    {
+        switch (compare)
+        {
+            case (CompareOperation::Never):
+            {
+                return vk::CompareOp::eNever;
+            }
+            case (CompareOperation::Less):
+            {
+                return vk::CompareOp::eLess;
+            }
+            case (CompareOperation::Equal):
+            {
+                return vk::CompareOp::eEqual;
+            }
+            case (CompareOperation::LessEqual):
+            {
+                return vk::CompareOp::eLessOrEqual;
+            }
+            case (CompareOperation::Greater):
+            {
+                return vk::CompareOp::eGreater;
+            }
+            case (CompareOperation::NotEqual):
+            {
+                return vk::CompareOp::eNotEqual;
+            }
+            case (CompareOperation::GreaterEqual):
+            {
+                return vk::CompareOp::eGreaterOrEqual;
+            }
+            case (CompareOperation::Always):
+            {
+                return vk::CompareOp::eAlways;
+            }
+        }
+
+        Console::Throw("Unsupported compare operation {}", static_cast<Types::UI32>(compare));
+
+        throw;
+    }
+
+    vk::PipelineColorBlendAttachmentState VulkanPipelineStates::GetBlendState(BlendMode blend)
+    {
+        auto state = vk::PipelineColorBlendAttachmentState{}
+                         .setColorWriteMask(vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA)
+                         .setColorBlendOp(vk::BlendOp::eAdd)
+                         .setAlphaBlendOp(vk::BlendOp::eAdd);
+
+        switch (blend)
+        {
+            case (BlendMode::Opaque):
+            {
+                return state.setBlendEnable(VK_FALSE);
+            }
+            case (BlendMode::Alpha):
+            {
+                return state.setBlendEnable(VK_TRUE)
+                    .setSrcColorBlendFactor(vk::BlendFactor::eSrcAlpha)
+                    .setDstColorBlendFactor(vk::BlendFactor::eOneMinusSrcAlpha)
+                    .setSrcAlphaBlendFactor(vk::BlendFactor::eOne)
+                    .setDstAlphaBlendFactor(vk::BlendFactor::eOneMinusSrcAlpha);
+            }
+            case (BlendMode::Premultiplied):
+            {
+                return state.setBlendEnable(VK_TRUE)
+                    .setSrcColorBlendFactor(vk::BlendFactor::eOne)
+                    .setDstColorBlendFactor(vk::BlendFactor::eOneMinusSrcAlpha)
+                    .setSrcAlphaBlendFactor(vk::BlendFactor::eOne)
+                    .setDstAlphaBlendFactor(vk::BlendFactor::eOneMinusSrcAlpha);
+            }
+            case (BlendMode::Additive):
+            {
+                return state.setBlendEnable(VK_TRUE)
+                    .setSrcColorBlendFactor(vk::BlendFactor::eOne)
+                    .setDstColorBlendFactor(vk::BlendFactor::eOne)
+                    .setSrcAlphaBlendFactor(vk::BlendFactor::eOne)
+                    .setDstAlphaBlendFactor(vk::BlendFactor::eOne);
+            }
+        }
+
+        Console::Throw("Unsupported blend mode {}", static_cast<Types::UI32>(blend));
+
+        throw;
+    }
+}
\ No newline at end of file
@@ -136,4 +136,57 @@ namespace Mosaic::Internal::Rendering
     {
         return mPresentFamily.value_or(mGraphicsFamily.value());
     }
+
+    vk::Queue VulkanQueues::GetQueue(VulkanQueueType type) const
+    {
+        switch (type)
+        {
+            case (VulkanQueueType::Compute):
+            {
+                return mComputeQueue;
+            }
+            case (VulkanQueueType::Transfer):
+            {
+                return mTransferQueue;
+            }
+            default:
+            {
+                return mGraphicsQueue;
+            }
+        }
+    }
+
+    Types::UI32 VulkanQueues::GetQueueFamily(VulkanQueueType type) const
+    {
+        switch (type)
+        {
+            case (VulkanQueueType::Compute):
+            {
+                return GetComputeQueueFamily();
+            }
+            case (VulkanQueueType::Transfer):
+            {
+                return GetTransferQueueFamily();
+            }
+            default:
+            {
+                return GetGraphicsQueueFamily();
+            }
+        }
+    }
+
+    VulkanQueueType VulkanQueues::Resolve(VulkanQueueType type) const
+    {
+        if (GetQueueFamily(type) == GetGraphicsQueueFamily())
+        {
+            return VulkanQueueType::Graphics;
+        }
+
+        if (type == VulkanQueueType::Transfer and GetTransferQueueFamily() == GetComputeQueueFamily())
+        {
+            return VulkanQueueType::Compute;
+        }
+
+        return type;
+    }
 }
\ No newline at end of file
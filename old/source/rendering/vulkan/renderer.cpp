@@ -2,12 +2,33 @@
 
 #include "application/window.hpp"
 
+#include "utilities/threading.hpp"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
 namespace Mosaic::Internal::Rendering
 {
     VulkanRenderer::VulkanRenderer(Renderer& renderer)
-        : mRenderer(renderer), mRebuildSwapchainSuboptimal(false), mRebuildSwapchainOutOfDate(false)
+        : mRenderer(renderer), mTransientMemoryTypes(~0u), mRebuildSwapchainSuboptimal(false), mRebuildSwapchainOutOfDate(false)
     {
-        mRenderer.mEventManager.Subscribe(this, &VulkanRenderer::ResizeCallback);
+    }
+
+    VulkanRenderer::~VulkanRenderer()
+    {
+        if (mDevice.Get())
+        {
+            mDevice.WaitIdle();
+        }
+
+        mTransientImages.clear();
+        mTransientBuffers.clear();
+
+        mMemory.Free(mTransientAllocation);
     }
 
     void VulkanRenderer::Create()
@@ -29,10 +50,27 @@ namespace Mosaic::Internal::Rendering
         mDevice.GetExtensions(mPhysicalDevice, {}, {});
         mDevice.Create(mQueues, mPhysicalDevice);
 
+        mPipelineCache.Create(mPhysicalDevice, mDevice, (std::filesystem::path(mRenderer.mConfigPath).parent_path() / "cache").string());
+
         mRenderPass.Create(mDevice, mSurface);
 
+        mPipelineStates.Create(mDevice, mPipelineCache, mRenderPass);
+
         mQueues.Load(mDevice);
 
+        mMemory.Create(mPhysicalDevice, mDevice);
+
+        mStaging.Create(mDevice, mQueues, mMemory, VulkanSwapchain::MaxFramesInFlight);
+        mMeshes.Create(mQueues, mMemory, mStaging);
+
+        mScheduler.Create(mDevice);
+
+        CreateFrameGraph();
+
+        mCommandSystem.Create(mDevice, mQueues, mScheduler, VulkanSwapchain::MaxFramesInFlight, Threading::ThreadPool::GetShared().GetWorkerCount() + 1);
+
+        mWindowSize = mRenderer.mWindow.mSize;
+
         CreateSwapchain();
     }
 
@@ -40,8 +78,6 @@ namespace Mosaic::Internal::Rendering
     {
         mDevice.WaitIdle();
 
-        mCommandSystem.Reset();
-
         for (auto& framebuffer : mFramebuffers)
         {
             framebuffer.Reset();
@@ -63,13 +99,208 @@ namespace Mosaic::Internal::Rendering
             framebuffer.GetIndex() = index;
             framebuffer.Create(mDevice, mSurface, mRenderPass, mSwapchain);
         }
+    }
+
+    void VulkanRenderer::CreateFrameGraph()
+    {
+        mFrameGraph.Reset();
+
+        mSwapchainResource = mFrameGraph.ImportResource("Swapchain", {.Format = static_cast<Types::UI32>(mSurface.GetFormat().format)});
+
+        const Types::UI32 clear = mFrameGraph.AddPass("Clear");
+
+        mFrameGraph.Write(clear, mSwapchainResource, RenderResourceUsage::ColourAttachment);
+
+        mBarriers.SetInitialState(mSwapchainResource, {vk::PipelineStageFlagBits2::eColorAttachmentOutput, vk::AccessFlagBits2::eNone, vk::ImageLayout::eUndefined});
+        mBarriers.SetFinalState(mSwapchainResource, VulkanBarrierPlanner::GetState(RenderResourceUsage::Present, false));
+
+        CreateTransientResources();
+
+        const CompiledRenderGraph& compiled = mFrameGraph.Compile();
+
+        BindTransientResources(compiled);
 
-        mCommandSystem.Create(mDevice, mQueues);
-        mCommandSystem.AllocateCommandBuffers(mDevice, mSwapchain);
+        mScheduler.Schedule(mFrameGraph, compiled, mQueues);
+
+        mBarriers.Plan(mFrameGraph, compiled, mScheduler.GetPassQueues());
+
+        mClearPosition = std::ranges::find(compiled.Order, clear) - compiled.Order.begin();
+    }
+
+    void VulkanRenderer::CreateTransientResources()
+    {
+        const std::vector<RenderGraphResource>& resources = mFrameGraph.GetResources();
+
+        mTransientImages.clear();
+        mTransientBuffers.clear();
+
+        mTransientImages.resize(resources.size());
+        mTransientBuffers.resize(resources.size());
+
+        mTransientMemoryTypes = ~0u;
+
+        std::vector<vk::ImageUsageFlags> imageUsage(resources.size());
+        std::vector<vk::BufferUsageFlags> bufferUsage(resources.size());
+
+        for (const RenderGraphPass& pass : mFrameGraph.GetPasses())
+        {
+            for (const RenderGraphAccess& access : pass.Accesses)
+            {
+                switch (access.Usage)
+                {
+                    case (RenderResourceUsage::ColourAttachment):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eColorAttachment;
+
+                        break;
+                    }
+                    case (RenderResourceUsage::DepthStencilAttachment):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eDepthStencilAttachment;
+
+                        break;
+                    }
+                    case (RenderResourceUsage::Sampled):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eSampled;
+                        bufferUsage[access.Resource] |= vk::BufferUsageFlagBits::eUniformBuffer;
+
+                        break;
+                    }
+                    case (RenderResourceUsage::Storage):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eStorage;
+                        bufferUsage[access.Resource] |= vk::BufferUsageFlagBits::eStorageBuffer;
+
+                        break;
+                    }
+                    case (RenderResourceUsage::TransferSource):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eTransferSrc;
+                        bufferUsage[access.Resource] |= vk::BufferUsageFlagBits::eTransferSrc;
+
+                        break;
+                    }
+                    case (RenderResourceUsage::TransferDestination):
+                    {
+                        imageUsage[access.Resource] |= vk::ImageUsageFlagBits::eTransferDst;
+                        bufferUsage[access.Resource] |= vk::BufferUsageFlagBits::eTransferDst;
+
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (Types::UI32 resource = 0; resource < resources.size(); resource++)
+        {
+            const RenderResourceDescriptor& descriptor = resources[resource].Descriptor;
+
+            if (resources[resource].Imported)
+            {
+                continue;
+            }
+
+            vk::MemoryRequirements requirements;
+
+            if (descriptor.Type == RenderResourceType::Image)
+            {
+                if (descriptor.Width == 0 or descriptor.Height == 0 or not imageUsage[resource])
+                {
+                    continue;
+                }
+
+                vk::ImageCreateInfo imageInfo{{}, vk::ImageType::e2D, static_cast<vk::Format>(descriptor.Format), vk::Extent3D{descriptor.Width, descriptor.Height, 1}, 1, 1, vk::SampleCountFlagBits::e1, vk::ImageTiling::eOptimal, imageUsage[resource], vk::SharingMode::eExclusive};
+
+                mTransientImages[resource] = mDevice.Get().createImageUnique(imageInfo);
+
+                requirements = mDevice.Get().getImageMemoryRequirements(mTransientImages[resource].get());
+            }
+            else
+            {
+                if (descriptor.SizeBytes == 0 or not bufferUsage[resource])
+                {
+                    continue;
+                }
+
+                vk::BufferCreateInfo bufferInfo{{}, descriptor.SizeBytes, bufferUsage[resource], vk::SharingMode::eExclusive};
+
+                mTransientBuffers[resource] = mDevice.Get().createBufferUnique(bufferInfo);
+
+                requirements = mDevice.Get().getBufferMemoryRequirements(mTransientBuffers[resource].get());
+            }
+
+            mFrameGraph.SetMemoryRequirements(resource, requirements.size, requirements.alignment);
+
+            mTransientMemoryTypes &= requirements.memoryTypeBits;
+        }
+    }
+
+    void VulkanRenderer::BindTransientResources(const CompiledRenderGraph& compiled)
+    {
+        const std::vector<RenderGraphResource>& resources = mFrameGraph.GetResources();
+
+        mMemory.Free(mTransientAllocation);
+
+        vk::DeviceSize alignment = 1;
+
+        for (Types::UI32 resource = 0; resource < resources.size(); resource++)
+        {
+            if (compiled.Offsets[resource] == CompiledRenderGraph::NotAliased)
+            {
+                mTransientImages[resource].reset();
+                mTransientBuffers[resource].reset();
+
+                continue;
+            }
+
+            alignment = std::max<vk::DeviceSize>(alignment, resources[resource].Descriptor.Alignment);
+        }
+
+        if (compiled.TransientBytes == 0)
+        {
+            return;
+        }
+
+        mTransientAllocation = mMemory.Allocate({compiled.TransientBytes, alignment, mTransientMemoryTypes}, VulkanMemoryUsage::DeviceLocal, true);
+
+        for (Types::UI32 resource = 0; resource < resources.size(); resource++)
+        {
+            const vk::DeviceSize offset = mTransientAllocation.Offset + compiled.Offsets[resource];
+
+            if (mTransientImages[resource])
+            {
+                mDevice.Get().bindImageMemory(mTransientImages[resource].get(), mTransientAllocation.Memory, offset);
+            }
+            else if (mTransientBuffers[resource])
+            {
+                mDevice.Get().bindBufferMemory(mTransientBuffers[resource].get(), mTransientAllocation.Memory, offset);
+            }
+        }
     }
 
     void VulkanRenderer::Update()
     {
+        const RendererFramePacket& frame = *mRenderer.mFrame;
+
+        mMeshes.Evict(frame.ReleasedMeshes);
+
+        for (const RendererMeshUpload& upload : frame.MeshUploads)
+        {
+            mMeshes.Apply(upload);
+        }
+
+        if (frame.WindowSize.X != mWindowSize.X or frame.WindowSize.Y != mWindowSize.Y)
+        {
+            mWindowSize = frame.WindowSize;
+
+            mRebuildSwapchainOutOfDate = true;
+        }
+
         if (mRebuildSwapchainOutOfDate or mRebuildSwapchainSuboptimal)
         {
             CreateSwapchain();
@@ -90,21 +321,92 @@ namespace Mosaic::Internal::Rendering
             return;
         }
 
-        mCommandSystem.BeginFrame(imageIndex);
-        mCommandSystem.RecordCommands(mRenderPass, mFramebuffers[imageIndex], mSwapchain, imageIndex, {mRenderer.mClearColour.X, mRenderer.mClearColour.Y, mRenderer.mClearColour.Z, mRenderer.mClearColour.W});
-        mCommandSystem.EndFrame(imageIndex);
+        mStaging.BeginFrame(current);
+
+        auto prepare = [&]<typename T>(const T& command)
+        {
+            if constexpr (std::is_same_v<T, RendererPipelineBind>)
+            {
+                mPipelineStates.Acquire(command.Pipeline);
+            }
+            else if constexpr (std::is_same_v<T, RendererDraw>)
+            {
+                mMeshes.MarkRead(command.Mesh, mScheduler.GetFrameValue(VulkanQueueType::Graphics));
+            }
+        };
+
+        for (const RendererPacketCommand& command : frame.Commands)
+        {
+            std::visit(prepare, command);
+        }
+
+        vk::SemaphoreSubmitInfo transferWait{};
+
+        if (mMeshes.GetTransferWait() != 0)
+        {
+            transferWait = {mScheduler.GetTimeline(VulkanQueueType::Graphics), mMeshes.GetTransferWait(), vk::PipelineStageFlagBits2::eAllTransfer};
+        }
+
+        const vk::SemaphoreSubmitInfo uploads = mStaging.Flush(mQueues, current, transferWait);
+
+        mCommandSystem.BeginFrame(current);
+
+        const std::array images{mSwapchain.GetImage(imageIndex)};
+
+        mCommandSystem.RecordCommands(mRenderPass, mFramebuffers[imageIndex], mSwapchain, mBarriers, mScheduler, images, current, mClearPosition, {frame.ClearColour.X, frame.ClearColour.Y, frame.ClearColour.Z, frame.ClearColour.W});
+        mCommandSystem.EndFrame(current);
 
-        VulkanFrameSubmitDescriptor frameSubmitDescriptor = {
-            mCommandSystem.GetCommandBuffer(imageIndex),
-            frameSync.ImageAvailable.get(),
-            frameSync.RenderFinished.get(),
-            frameSync.InFlight.get(),
-            vk::PipelineStageFlagBits::eColorAttachmentOutput};
+        const vk::SemaphoreSubmitInfo imageAvailable{frameSync.ImageAvailable.get(), 0, vk::PipelineStageFlagBits2::eColorAttachmentOutput};
+        const vk::SemaphoreSubmitInfo renderFinished{frameSync.RenderFinished.get(), 0, vk::PipelineStageFlagBits2::eAllCommands};
+
+        const Types::UI32 firstGraphics = mScheduler.GetFirstBatch(VulkanQueueType::Graphics);
+        const Types::UI32 lastGraphics = mScheduler.GetLastBatch(VulkanQueueType::Graphics);
+        const Types::UI32 batchCount = mScheduler.GetBatches().size();
+
+        for (Types::UI32 batch = 0; batch < batchCount; batch++)
+        {
+            VulkanBatchSubmitDescriptor submitDescriptor = {};
 
-        mCommandSystem.SubmitFrame(mQueues.GetGraphicsQueue(), frameSubmitDescriptor);
+            const vk::CommandBuffer commandBuffer = mCommandSystem.GetCommandBuffer(current, batch);
+
+            submitDescriptor.Commands = {&commandBuffer, 1};
+
+            std::vector<vk::SemaphoreSubmitInfo> waits;
+
+            const vk::PipelineStageFlags2 uploadStages = uploads.stageMask & VulkanQueueScheduler::GetSupportedStages(mScheduler.GetBatches()[batch].Queue);
+
+            if (uploads.semaphore and uploadStages)
+            {
+                waits.push_back({uploads.semaphore, uploads.value, uploadStages});
+            }
+
+            if (batch == firstGraphics)
+            {
+                waits.push_back(imageAvailable);
+            }
+
+            submitDescriptor.Waits = waits;
+
+            if (batch == lastGraphics)
+            {
+                submitDescriptor.Signals = {&renderFinished, 1};
+            }
+
+            if (batch == batchCount - 1)
+            {
+                submitDescriptor.Fence = frameSync.InFlight.get();
+            }
+
+            mScheduler.Submit(mQueues, batch, submitDescriptor);
+        }
+
+        mScheduler.EndFrame();
+        mMeshes.EndFrame();
 
         mSwapchain.PresentFrame(*this, mQueues, imageIndex);
 
+        mPipelineCache.Update();
+
         if (mRebuildSwapchainOutOfDate)
         {
             return;
@@ -117,10 +419,8 @@ namespace Mosaic::Internal::Rendering
     {
     }
 
-    void VulkanRenderer::ResizeCallback(const Windowing::WindowResizeEvent& event)
+    void VulkanRenderer::PrewarmPipelines(std::span<const Pipeline> pipelines)
     {
-        mWindowSize = event.Size;
-
-        mRebuildSwapchainOutOfDate = true;
+        mPipelineStates.Prewarm(pipelines);
     }
 }
\ No newline at end of file
@@ -0,0 +1,300 @@
+#include "rendering/vulkan/scheduler.hpp"
+#include "rendering/vulkan/devices.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+
+namespace Mosaic::Internal::Rendering
+{
+    void VulkanQueueScheduler::Create(VulkanDevice& device)
+    {
+        vk::SemaphoreTypeCreateInfo typeInfo{vk::SemaphoreType::eTimeline, 0};
+        vk::SemaphoreCreateInfo semaphoreInfo{{}, &typeInfo};
+
+        for (auto& timeline : mTimelines)
+        {
+            timeline = device.Get().createSemaphoreUnique(semaphoreInfo);
+        }
+
+        mTimelineBases = {};
+    }
+
+    void VulkanQueueScheduler::Reset()
+    {
+        for (auto& timeline : mTimelines)
+        {
+            timeline.reset();
+        }
+
+        mBatches.clear();
+        mPassQueues.clear();
+        mPositionBatches.clear();
+    }
+
+    void VulkanQueueScheduler::Schedule(const LocalRenderGraph& graph, const CompiledRenderGraph& compiled, const VulkanQueues& queues)
+    {
+        const std::vector<RenderGraphPass>& passes = graph.GetPasses();
+        const std::vector<RenderGraphResource>& resources = graph.GetResources();
+
+        mBatches.clear();
+        mPassQueues.clear();
+        mPositionBatches.clear();
+
+        mFrameValues = {};
+
+        std::vector<Types::UI32> lastAccess(resources.size(), CompiledRenderGraph::Unused);
+
+        for (Types::UI32 position = 0; position < compiled.Order.size(); position++)
+        {
+            const RenderGraphPass& pass = passes[compiled.Order[position]];
+            const VulkanQueueType queue = Assign(pass, queues);
+            const vk::PipelineStageFlags2 supported = GetSupportedStages(queue);
+
+            if (mBatches.empty() or mBatches.back().Queue != queue)
+            {
+                mBatches.push_back({queue, position, 0, ++mFrameValues[static_cast<Types::UI32>(queue)], {}});
+            }
+
+            VulkanQueueBatch& batch = mBatches.back();
+
+            batch.PositionCount++;
+
+            mPositionBatches.push_back(mBatches.size() - 1);
+            mPassQueues.push_back({queues.GetQueueFamily(queue), supported});
+
+            auto depend = [&](Types::UI32 previous, vk::PipelineStageFlags2 stages)
+            {
+                if (previous == CompiledRenderGraph::Unused)
+                {
+                    return;
+                }
+
+                const VulkanQueueBatch& producer = mBatches[mPositionBatches[previous]];
+
+                if (producer.Queue == queue)
+                {
+                    return;
+                }
+
+                stages &= supported;
+
+                if (not stages)
+                {
+                    stages = vk::PipelineStageFlagBits2::eAllCommands;
+                }
+
+                auto found = std::ranges::find(batch.Waits, producer.Queue, &VulkanQueueWait::Queue);
+
+                if (found == batch.Waits.end())
+                {
+                    batch.Waits.push_back({producer.Queue, producer.Value, stages});
+
+                    return;
+                }
+
+                found->Value = std::max(found->Value, producer.Value);
+                found->Stages |= stages;
+            };
+
+            for (const RenderGraphAccess& access : pass.Accesses)
+            {
+                const vk::PipelineStageFlags2 stages = VulkanBarrierPlanner::GetState(access.Usage, access.Write).Stages;
+
+                depend(lastAccess[access.Resource], stages);
+
+                if (compiled.Lifetimes[access.Resource].FirstPass != position)
+                {
+                    continue;
+                }
+
+                for (Types::UI32 other = 0; other < resources.size(); other++)
+                {
+                    if (compiled.Lifetimes[other].LastPass < position and graph.SharesMemory(access.Resource, other))
+                    {
+                        depend(compiled.Lifetimes[other].LastPass, stages);
+                    }
+                }
+            }
+
+            for (const RenderGraphAccess& access : pass.Accesses)
+            {
+                lastAccess[access.Resource] = position;
+            }
+        }
+
+        if (mBatches.empty())
+        {
+            return;
+        }
+
+        VulkanQueueBatch& last = mBatches.back();
+
+        for (Types::UI32 index = 0; index < QueueCount; index++)
+        {
+            const VulkanQueueType queue = static_cast<VulkanQueueType>(index);
+
+            if (queue == last.Queue or mFrameValues[index] == 0)
+            {
+                continue;
+            }
+
+            auto found = std::ranges::find(last.Waits, queue, &VulkanQueueWait::Queue);
+
+            if (found == last.Waits.end())
+            {
+                last.Waits.push_back({queue, mFrameValues[index], vk::PipelineStageFlagBits2::eAllCommands});
+            }
+            else
+            {
+                found->Value = mFrameValues[index];
+            }
+        }
+    }
+
+    void VulkanQueueScheduler::Submit(const VulkanQueues& queues, Types::UI32 batch, const VulkanBatchSubmitDescriptor& descriptor)
+    {
+        if (batch >= mBatches.size())
+        {
+            Console::Throw("Queue batch {} was not scheduled ({} available)", batch, mBatches.size());
+        }
+
+        const VulkanQueueBatch& scheduled = mBatches[batch];
+        const Types::UI32 queue = static_cast<Types::UI32>(scheduled.Queue);
+
+        std::vector<vk::SemaphoreSubmitInfo> waits(descriptor.Waits.begin(), descriptor.Waits.end());
+        std::vector<vk::SemaphoreSubmitInfo> signals(descriptor.Signals.begin(), descriptor.Signals.end());
+        std::vector<vk::CommandBufferSubmitInfo> commands;
+
+        for (const VulkanQueueWait& wait : scheduled.Waits)
+        {
+            const Types::UI32 producer = static_cast<Types::UI32>(wait.Queue);
+
+            waits.push_back({mTimelines[producer].get(), mTimelineBases[producer] + wait.Value, wait.Stages});
+        }
+
+        signals.push_back({mTimelines[queue].get(), mTimelineBases[queue] + scheduled.Value, vk::PipelineStageFlagBits2::eAllCommands});
+
+        for (vk::CommandBuffer command : descriptor.Commands)
+        {
+            commands.push_back({command});
+        }
+
+        vk::SubmitInfo2 submitInfo{};
+
+        submitInfo.setWaitSemaphoreInfos(waits);
+        submitInfo.setCommandBufferInfos(commands);
+        submitInfo.setSignalSemaphoreInfos(signals);
+
+        queues.GetQueue(scheduled.Queue).submit2(submitInfo, descriptor.Fence);
+    }
+
+    void VulkanQueueScheduler::EndFrame()
+    {
+        for (Types::UI32 index = 0; index < QueueCount; index++)
+        {
+            mTimelineBases[index] += mFrameValues[index];
+        }
+    }
+
+    const std::vector<VulkanQueueBatch>& VulkanQueueScheduler::GetBatches() const
+    {
+        return mBatches;
+    }
+
+    const std::vector<VulkanPassQueue>& VulkanQueueScheduler::GetPassQueues() const
+    {
+        return mPassQueues;
+    }
+
+    Types::UI32 VulkanQueueScheduler::GetFirstBatch(VulkanQueueType queue) const
+    {
+        auto found = std::ranges::find(mBatches, queue, &VulkanQueueBatch::Queue);
+
+        return found == mBatches.end() ? NoBatch : found - mBatches.begin();
+    }
+
+    Types::UI32 VulkanQueueScheduler::GetLastBatch(VulkanQueueType queue) const
+    {
+        for (Types::UI32 index = mBatches.size(); index > 0; index--)
+        {
+            if (mBatches[index - 1].Queue == queue)
+            {
+                return index - 1;
+            }
+        }
+
+        return NoBatch;
+    }
+
+    vk::Semaphore VulkanQueueScheduler::GetTimeline(VulkanQueueType queue) const
+    {
+        return mTimelines[static_cast<Types::UI32>(queue)].get();
+    }
+
+    Types::UI64 VulkanQueueScheduler::GetFrameValue(VulkanQueueType queue) const
+    {
+        const Types::UI32 index = static_cast<Types::UI32>(queue);
+
+        return mTimelineBases[index] + mFrameValues[index];
+    }
+
+    vk::PipelineStageFlags2 VulkanQueueScheduler::GetSupportedStages(VulkanQueueType queue)
+    {
+        switch (queue)
+        {
+            case (VulkanQueueType::Compute):
+            {
+                return vk::PipelineStageFlagBits2::eComputeShader | vk::PipelineStageFlagBits2::eTransfer;
+            }
+            case (VulkanQueueType::Transfer):
+            {
+                return vk::PipelineStageFlagBits2::eTransfer;
+            }
+            default:
+            {
+                return vk::PipelineStageFlags2(~VkPipelineStageFlags2{0});
+            }
+        }
+    }
+
+    VulkanQueueType VulkanQueueScheduler::Assign(const RenderGraphPass& pass, const VulkanQueues& queues) const
+    {
+        VulkanQueueType queue = VulkanQueueType::Graphics;
+
+        switch (pass.Queue)
+        {
+            case (RenderGraphQueue::Compute):
+            {
+                queue = VulkanQueueType::Compute;
+                break;
+            }
+            case (RenderGraphQueue::Transfer):
+            {
+                queue = VulkanQueueType::Transfer;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        for (const RenderGraphAccess& access : pass.Accesses)
+        {
+            const bool transfer = access.Usage == RenderResourceUsage::TransferSource or access.Usage == RenderResourceUsage::TransferDestination;
+            const bool shader = access.Usage == RenderResourceUsage::Sampled or access.Usage == RenderResourceUsage::Storage;
+
+            const bool eligible = queue == VulkanQueueType::Graphics or transfer or (queue == VulkanQueueType::Compute and shader);
+
+            if (not eligible)
+            {
+                Console::LogWarning("Render graph pass '{}' uses resources its queue cannot access, falling back to graphics", pass.Name);
+
+                return VulkanQueueType::Graphics;
+            }
+        }
+
+        return queues.Resolve(queue);
+    }
+}
@@ -0,0 +1,277 @@
+#include "rendering/vulkan/staging.hpp"
+#include "rendering/vulkan/devices.hpp"
+#include "rendering/vulkan/queues.hpp"
+
+#include "application/console.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Mosaic::Internal::Rendering
+{
+    void VulkanStagingRing::Create(VulkanDevice& device, const VulkanQueues& queues, VulkanMemoryAllocator& memory, Types::UI32 frameCount, vk::DeviceSize capacity)
+    {
+        Reset();
+
+        mDevice = device.Get();
+        mMemory = &memory;
+        mCapacity = capacity;
+
+        vk::BufferCreateInfo bufferInfo{{}, capacity, vk::BufferUsageFlagBits::eTransferSrc, vk::SharingMode::eExclusive};
+
+        mBuffer = memory.CreateBuffer(bufferInfo, VulkanMemoryUsage::Upload, mAllocation);
+
+        if (not mAllocation.Mapped)
+        {
+            Console::Throw("Staging ring memory is not host visible");
+        }
+
+        vk::SemaphoreTypeCreateInfo typeInfo{vk::SemaphoreType::eTimeline, 0};
+        vk::SemaphoreCreateInfo semaphoreInfo{{}, &typeInfo};
+
+        mTimeline = mDevice.createSemaphoreUnique(semaphoreInfo);
+        mTimelineValue = 0;
+
+        mFrames.resize(frameCount);
+
+        for (Frame& frame : mFrames)
+        {
+            vk::CommandPoolCreateInfo poolCreateInfo{vk::CommandPoolCreateFlagBits::eTransient, queues.GetTransferQueueFamily()};
+
+            frame.Pool = mDevice.createCommandPoolUnique(poolCreateInfo);
+
+            vk::CommandBufferAllocateInfo allocInfo{frame.Pool.get(), vk::CommandBufferLevel::ePrimary, 1};
+
+            frame.Commands = mDevice.allocateCommandBuffers(allocInfo).front();
+            frame.Fence = mDevice.createFenceUnique({});
+        }
+    }
+
+    void VulkanStagingRing::Reset()
+    {
+        std::lock_guard lock(mMutex);
+
+        mFrames.clear();
+        mPending.clear();
+        mPendingCompletions.clear();
+        mDeferred.clear();
+
+        mBuffer.reset();
+        mTimeline.reset();
+
+        if (mMemory)
+        {
+            mMemory->Free(mAllocation);
+        }
+
+        mHead = 0;
+        mUsed = 0;
+        mPendingBytes = 0;
+    }
+
+    std::shared_future<void> VulkanStagingRing::Upload(std::span<const std::byte> data, vk::Buffer destination, vk::DeviceSize destinationOffset)
+    {
+        auto completion = std::make_shared<std::promise<void>>();
+
+        std::shared_future<void> future = completion->get_future().share();
+
+        if (data.empty())
+        {
+            completion->set_value();
+
+            return future;
+        }
+
+        std::lock_guard lock(mMutex);
+
+        if (mDeferred.empty() and Stage(data, destination, destinationOffset, completion))
+        {
+            return future;
+        }
+
+        for (vk::DeviceSize first = 0; first < data.size(); first += mCapacity)
+        {
+            const std::span<const std::byte> chunk = data.subspan(first, std::min<vk::DeviceSize>(mCapacity, data.size() - first));
+
+            const bool last = first + chunk.size() == data.size();
+
+            mDeferred.push_back({std::vector<std::byte>(chunk.begin(), chunk.end()), destination, destinationOffset + first, last ? completion : nullptr});
+
+            mStatistics.DeferredUploads++;
+        }
+
+        return future;
+    }
+
+    void VulkanStagingRing::BeginFrame(Types::UI32 frame)
+    {
+        std::lock_guard lock(mMutex);
+
+        Frame& slot = mFrames[frame];
+
+        if (slot.Submitted)
+        {
+            const vk::Result result = mDevice.waitForFences(slot.Fence.get(), VK_TRUE, UINT64_MAX);
+
+            if (result != vk::Result::eSuccess)
+            {
+                Console::Throw("Failed to await staging fence: {}", vk::to_string(result));
+            }
+
+            mUsed -= slot.Bytes;
+
+            for (const auto& completion : slot.Completions)
+            {
+                completion->set_value();
+            }
+
+            slot.Completions.clear();
+            slot.Bytes = 0;
+            slot.Submitted = false;
+        }
+
+        while (not mDeferred.empty())
+        {
+            DeferredUpload& upload = mDeferred.front();
+
+            if (not Stage(upload.Data, upload.Destination, upload.DestinationOffset, upload.Completion))
+            {
+                break;
+            }
+
+            mDeferred.pop_front();
+        }
+    }
+
+    vk::SemaphoreSubmitInfo VulkanStagingRing::Flush(const VulkanQueues& queues, Types::UI32 frame, const vk::SemaphoreSubmitInfo& wait)
+    {
+        std::lock_guard lock(mMutex);
+
+        if (mPending.empty())
+        {
+            return {};
+        }
+
+        Frame& slot = mFrames[frame];
+
+        mDevice.resetCommandPool(slot.Pool.get());
+
+        slot.Commands.begin(vk::CommandBufferBeginInfo{vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr});
+
+        std::ranges::stable_sort(mPending, std::ranges::less(), [](const PendingCopy& copy)
+                                 { return static_cast<VkBuffer>(copy.Destination); });
+
+        std::vector<vk::BufferCopy> regions;
+
+        for (Types::UI64 index = 0; index < mPending.size();)
+        {
+            const vk::Buffer destination = mPending[index].Destination;
+
+            regions.clear();
+
+            while (index < mPending.size() and mPending[index].Destination == destination)
+            {
+                regions.push_back(mPending[index++].Region);
+            }
+
+            slot.Commands.copyBuffer(mBuffer.get(), destination, regions);
+        }
+
+        slot.Commands.end();
+
+        mDevice.resetFences(slot.Fence.get());
+
+        vk::CommandBufferSubmitInfo commandInfo{slot.Commands};
+        vk::SemaphoreSubmitInfo signalInfo{mTimeline.get(), ++mTimelineValue, vk::PipelineStageFlagBits2::eAllTransfer};
+
+        vk::SubmitInfo2 submitInfo{};
+
+        if (wait.semaphore)
+        {
+            submitInfo.setWaitSemaphoreInfos(wait);
+        }
+
+        submitInfo.setCommandBufferInfos(commandInfo);
+        submitInfo.setSignalSemaphoreInfos(signalInfo);
+
+        queues.GetTransferQueue().submit2(submitInfo, slot.Fence.get());
+
+        slot.Bytes = std::exchange(mPendingBytes, 0);
+        slot.Completions = std::move(mPendingCompletions);
+        slot.Submitted = true;
+
+        mPendingCompletions.clear();
+        mPending.clear();
+
+        mStatistics.Submissions++;
+
+        const vk::PipelineStageFlags2 consumers = vk::PipelineStageFlagBits2::eVertexInput | vk::PipelineStageFlagBits2::eVertexShader | vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader;
+
+        return {mTimeline.get(), mTimelineValue, consumers};
+    }
+
+    VulkanStagingStatistics VulkanStagingRing::GetStatistics() const
+    {
+        std::lock_guard lock(mMutex);
+
+        return mStatistics;
+    }
+
+    bool VulkanStagingRing::Stage(std::span<const std::byte> data, vk::Buffer destination, vk::DeviceSize destinationOffset, const std::shared_ptr<std::promise<void>>& completion)
+    {
+        const vk::DeviceSize offset = Reserve(data.size());
+
+        if (offset == NoSpace)
+        {
+            return false;
+        }
+
+        std::memcpy(mAllocation.Mapped + offset, data.data(), data.size());
+
+        mPending.push_back({destination, {offset, destinationOffset, data.size()}});
+
+        if (completion)
+        {
+            mPendingCompletions.push_back(completion);
+        }
+
+        mStatistics.UploadedBytes += data.size();
+        mStatistics.Copies++;
+
+        return true;
+    }
+
+    vk::DeviceSize VulkanStagingRing::Reserve(vk::DeviceSize size)
+    {
+        if (size > mCapacity)
+        {
+            return NoSpace;
+        }
+
+        if (mUsed == 0)
+        {
+            mHead = 0;
+        }
+
+        vk::DeviceSize offset = (mHead + CopyAlignment - 1) / CopyAlignment * CopyAlignment;
+
+        if (offset + size > mCapacity)
+        {
+            offset = 0;
+        }
+
+        const vk::DeviceSize consumed = offset >= mHead ? offset + size - mHead : mCapacity - mHead + size;
+
+        if (mUsed + consumed > mCapacity)
+        {
+            return NoSpace;
+        }
+
+        mUsed += consumed;
+        mPendingBytes += consumed;
+        mHead = offset + size;
+
+        return offset;
+    }
+}
\ No newline at end of file
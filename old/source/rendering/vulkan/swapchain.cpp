@@ -70,8 +70,8 @@ namespace Mosaic::Internal::Rendering
             vk::AttachmentStoreOp::eStore,
             vk::AttachmentLoadOp::eDontCare,
             vk::AttachmentStoreOp::eDontCare,
-            vk::ImageLayout::eUndefined,
-            vk::ImageLayout::ePresentSrcKHR};
+            vk::ImageLayout::eColorAttachmentOptimal,
+            vk::ImageLayout::eColorAttachmentOptimal};
 
         vk::AttachmentReference colourAttachmentRef = {
             0,
@@ -85,22 +85,12 @@ namespace Mosaic::Internal::Rendering
             1,
             &colourAttachmentRef};
 
-        vk::SubpassDependency dependency = {
-            VK_SUBPASS_EXTERNAL,
-            0,
-            vk::PipelineStageFlagBits::eColorAttachmentOutput,
-            vk::PipelineStageFlagBits::eColorAttachmentOutput,
-            {},
-            vk::AccessFlagBits::eColorAttachmentWrite};
-
         vk::RenderPassCreateInfo renderPassInfo = {
             {},
             1,
             &colourAttachment,
             1,
-            &subpass,
-            1,
-            &dependency};
+            &subpass};
 
         mRenderPass = device.Get().createRenderPassUnique(renderPassInfo);
     }
@@ -164,7 +154,7 @@ namespace Mosaic::Internal::Rendering
         mPresentMode = (it != fallbackList.end() ? *it : vk::PresentModeKHR::eFifo);
 
         mImageCount = std::max(2u, capabilities.minImageCount);
-        mFramesInFlight = std::clamp(mImageCount - 1, 1u, 3u);
+        mFramesInFlight = std::clamp(mImageCount - 1, 1u, MaxFramesInFlight);
 
         if (capabilities.maxImageCount > 0)
         {
@@ -215,6 +205,7 @@ namespace Mosaic::Internal::Rendering
     {
         mSyncFrames.clear();
         mSyncFrames.reserve(mFramesInFlight);
+        mCurrentFrame = 0;
         mImagesInFlight.resize(mImageCount, VK_NULL_HANDLE);
 
         vk::SemaphoreCreateInfo semaphoreInfo{};
@@ -0,0 +1,132 @@
+#include "rendering/vulkan/vertex.hpp"
+
+#include "application/console.hpp"
+
+#include <array>
+
+namespace Mosaic::Internal::Rendering
+{
+    void VulkanVertexInput::Create(const VertexLayoutDescriptor& layout)
+    {
+        mBindings.clear();
+        mAttributes.clear();
+
+        mBindings.reserve(layout.Streams.size());
+        mAttributes.reserve(layout.Attributes.size());
+
+        for (const auto& stream : layout.Streams)
+        {
+            mBindings.push_back(vk::VertexInputBindingDescription{}
+                                    .setBinding(stream.Binding)
+                                    .setStride(stream.StrideBytes)
+                                    .setInputRate(vk::VertexInputRate::eVertex));
+        }
+
+        for (const auto& attribute : layout.Attributes)
+        {
+            mAttributes.push_back(vk::VertexInputAttributeDescription{}
+                                      .setLocation(attribute.Location)
+                                      .setBinding(layout.Streams[attribute.Stream].Binding)
+                                      .setFormat(GetFormat(attribute.Type, attribute.ComponentCount))
+                                      .setOffset(attribute.OffsetBytes));
+        }
+    }
+
+    vk::PipelineVertexInputStateCreateInfo VulkanVertexInput::GetCreateInfo() const
+    {
+        return vk::PipelineVertexInputStateCreateInfo{}
+            .setVertexBindingDescriptions(mBindings)
+            .setVertexAttributeDescriptions(mAttributes);
+    }
+
+    vk::Format VulkanVertexInput::GetFormat(VertexAttributeType type, Types::UI32 componentCount)
+    {
+        using Formats = std::array<vk::Format, 4>;
+
+        auto select = [&](const Formats& formats)
+        {
+            if (componentCount < 1 or componentCount > 4)
+            {
+                Console::Throw("Vertex attributes must have between 1 and 4 components, got {}", componentCount);
+            }
+
+            return formats[componentCount - 1];
+        };
+
+        switch (type)
+        {
+            case (VertexAttributeType::F32):
+            {
+                return select({vk::Format::eR32Sfloat, vk::Format::eR32G32Sfloat, vk::Format::eR32G32B32Sfloat, vk::Format::eR32G32B32A32Sfloat});
+            }
+            case (VertexAttributeType::F64):
+            {
+                return select({vk::Format::eR64Sfloat, vk::Format::eR64G64Sfloat, vk::Format::eR64G64B64Sfloat, vk::Format::eR64G64B64A64Sfloat});
+            }
+            case (VertexAttributeType::I8):
+            {
+                return select({vk::Format::eR8Sint, vk::Format::eR8G8Sint, vk::Format::eR8G8B8Sint, vk::Format::eR8G8B8A8Sint});
+            }
+            case (VertexAttributeType::I16):
+            {
+                return select({vk::Format::eR16Sint, vk::Format::eR16G16Sint, vk::Format::eR16G16B16Sint, vk::Format::eR16G16B16A16Sint});
+            }
+            case (VertexAttributeType::I32):
+            {
+                return select({vk::Format::eR32Sint, vk::Format::eR32G32Sint, vk::Format::eR32G32B32Sint, vk::Format::eR32G32B32A32Sint});
+            }
+            case (VertexAttributeType::I64):
+            {
+                return select({vk::Format::eR64Sint, vk::Format::eR64G64Sint, vk::Format::eR64G64B64Sint, vk::Format::eR64G64B64A64Sint});
+            }
+            case (VertexAttributeType::UI8):
+            {
+                return select({vk::Format::eR8Uint, vk::Format::eR8G8Uint, vk::Format::eR8G8B8Uint, vk::Format::eR8G8B8A8Uint});
+            }
+            case (VertexAttributeType::UI16):
+            {
+                return select({vk::Format::eR16Uint, vk::Format::eR16G16Uint, vk::Format::eR16G16B16Uint, vk::Format::eR16G16B16A16Uint});
+            }
+            case (VertexAttributeType::UI32):
+            {
+                return select({vk::Format::eR32Uint, vk::Format::eR32G32Uint, vk::Format::eR32G32B32Uint, vk::Format::eR32G32B32A32Uint});
+            }
+            case (VertexAttributeType::UI64):
+            {
+                return select({vk::Format::eR64Uint, vk::Format::eR64G64Uint, vk::Format::eR64G64B64Uint, vk::Format::eR64G64B64A64Uint});
+            }
+            case (VertexAttributeType::F16):
+            {
+                return select({vk::Format::eR16Sfloat, vk::Format::eR16G16Sfloat, vk::Format::eR16G16B16Sfloat, vk::Format::eR16G16B16A16Sfloat});
+            }
+            case (VertexAttributeType::UNorm8):
+            {
+                return select({vk::Format::eR8Unorm, vk::Format::eR8G8Unorm, vk::Format::eR8G8B8Unorm, vk::Format::eR8G8B8A8Unorm});
+            }
+            case (VertexAttributeType::UNorm16):
+            {
+                return select({vk::Format::eR16Unorm, vk::Format::eR16G16Unorm, vk::Format::eR16G16B16Unorm, vk::Format::eR16G16B16A16Unorm});
+            }
+            case (VertexAttributeType::SNorm8):
+            {
+                return select({vk::Format::eR8Snorm, vk::Format::eR8G8Snorm, vk::Format::eR8G8B8Snorm, vk::Format::eR8G8B8A8Snorm});
+            }
+            case (VertexAttributeType::SNorm16):
+            {
+                return select({vk::Format::eR16Snorm, vk::Format::eR16G16Snorm, vk::Format::eR16G16B16Snorm, vk::Format::eR16G16B16A16Snorm});
+            }
+            case (VertexAttributeType::UNorm1010102):
+            {
+                return vk::Format::eA2B10G10R10UnormPack32;
+            }
+            case (VertexAttributeType::SNorm1010102):
+            {
+                return vk::Format::eA2B10G10R10SnormPack32;
+            }
+        }
+
+        Console::Throw("Unknown vertex attribute type");
+
+        throw;
+    }
+}
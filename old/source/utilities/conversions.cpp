@@ -0,0 +1,541 @@
+#include "utilities/conversions.hpp"
+#include "utilities/simd.hpp"
+
+#include "application/console.hpp"
+
+#include <type_traits>
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace Mosaic::Internal::Conversions::Detail
+{
+    using Types::F32;
+    using Types::UI64;
+
+    template <typename Input, typename Output>
+    void ConvertScalar(const Input* input, Output* output, UI64 count)
+    {
+        for (UI64 index = 0; index < count; index++)
+        {
+            output[index] = static_cast<Output>(static_cast<F32>(input[index]));
+        }
+    }
+
+    template <typename Packed>
+    void PackScalar(const Types::Vec4<F32>* input, Packed* output, UI64 count)
+    {
+        for (UI64 index = 0; index < count; index++)
+        {
+            const auto& value = input[index];
+
+            output[index] = Packed(value.X, value.Y, value.Z, value.W);
+        }
+    }
+
+    template <typename Packed>
+    void UnpackScalar(const Packed* input, Types::Vec4<F32>* output, UI64 count)
+    {
+        for (UI64 index = 0; index < count; index++)
+        {
+            const auto& value = input[index];
+
+            output[index] = Types::Vec4<F32>(value.Get(0), value.Get(1), value.Get(2), value.Get(3));
+        }
+    }
+
+    template <typename Input, typename Output>
+    void ValidateCounts(std::span<const Input> input, std::span<Output> output)
+    {
+        if (input.size() != output.size())
+        {
+            Console::Throw("Conversion input and output lengths do not match ({} and {})", input.size(), output.size());
+        }
+    }
+
+#if defined(__x86_64__) or defined(__i386__)
+    [[gnu::target("avx2,fma,f16c")]] UI64 FloatToHalfAVX2(const F32* input, Types::F16* output, UI64 count)
+    {
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(input + index), _MM_FROUND_TO_NEAREST_INT);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), half);
+        }
+
+        return index;
+    }
+
+    [[gnu::target("avx2,fma,f16c")]] UI64 HalfToFloatAVX2(const Types::F16* input, F32* output, UI64 count)
+    {
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+
+            _mm256_storeu_ps(output + index, _mm256_cvtph_ps(half));
+        }
+
+        return index;
+    }
+
+    [[gnu::target("avx512f")]] UI64 FloatToHalfAVX512(const F32* input, Types::F16* output, UI64 count)
+    {
+        UI64 index = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            const __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(input + index), _MM_FROUND_TO_NEAREST_INT);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), half);
+        }
+
+        return index;
+    }
+
+    [[gnu::target("avx512f")]] UI64 HalfToFloatAVX512(const Types::F16* input, F32* output, UI64 count)
+    {
+        UI64 index = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            const __m256i half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + index));
+
+            _mm512_storeu_ps(output + index, _mm512_cvtph_ps(half));
+        }
+
+        return index;
+    }
+
+    template <typename T>
+    [[gnu::target("sse2")]] __m128i ScaleToIntegerSSE2(__m128 value)
+    {
+        constexpr bool isSigned = std::is_same_v<T, Types::SNorm8> or std::is_same_v<T, Types::SNorm16>;
+
+        value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+        value = _mm_max_ps(value, _mm_set1_ps(isSigned ? -1.0f : 0.0f));
+        value = _mm_min_ps(value, _mm_set1_ps(1.0f));
+
+        return _mm_cvtps_epi32(_mm_mul_ps(value, _mm_set1_ps(static_cast<F32>(T::Maximum))));
+    }
+
+    template <typename T>
+    [[gnu::target("sse2")]] UI64 EncodeNormalisedSSE2(const F32* input, T* output, UI64 count)
+    {
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m128i low = ScaleToIntegerSSE2<T>(_mm_loadu_ps(input + index));
+            const __m128i high = ScaleToIntegerSSE2<T>(_mm_loadu_ps(input + index + 4));
+
+            auto* destination = reinterpret_cast<__m128i*>(output + index);
+
+            if constexpr (std::is_same_v<T, Types::UNorm8>)
+            {
+                const __m128i words = _mm_packs_epi32(low, high);
+
+                _mm_storel_epi64(destination, _mm_packus_epi16(words, words));
+            }
+            else if constexpr (std::is_same_v<T, Types::SNorm8>)
+            {
+                const __m128i words = _mm_packs_epi32(low, high);
+
+                _mm_storel_epi64(destination, _mm_packs_epi16(words, words));
+            }
+            else if constexpr (std::is_same_v<T, Types::UNorm16>)
+            {
+                const __m128i bias = _mm_set1_epi32(32768);
+                const __m128i words = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+
+                _mm_storeu_si128(destination, _mm_xor_si128(words, _mm_set1_epi16(static_cast<short>(0x8000))));
+            }
+            else
+            {
+                _mm_storeu_si128(destination, _mm_packs_epi32(low, high));
+            }
+        }
+
+        return index;
+    }
+
+    template <typename T>
+    [[gnu::target("sse2")]] UI64 DecodeNormalisedSSE2(const T* input, F32* output, UI64 count)
+    {
+        constexpr bool isSigned = std::is_same_v<T, Types::SNorm8> or std::is_same_v<T, Types::SNorm16>;
+
+        const __m128 maximum = _mm_set1_ps(static_cast<F32>(T::Maximum));
+        const __m128 minimum = _mm_set1_ps(-1.0f);
+
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const auto* source = reinterpret_cast<const __m128i*>(input + index);
+
+            __m128i words;
+
+            if constexpr (std::is_same_v<T, Types::UNorm8>)
+            {
+                words = _mm_unpacklo_epi8(_mm_loadl_epi64(source), _mm_setzero_si128());
+            }
+            else if constexpr (std::is_same_v<T, Types::SNorm8>)
+            {
+                const __m128i bytes = _mm_loadl_epi64(source);
+
+                words = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+            }
+            else
+            {
+                words = _mm_loadu_si128(source);
+            }
+
+            __m128i low;
+            __m128i high;
+
+            if constexpr (isSigned)
+            {
+                low = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+                high = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+            }
+            else
+            {
+                low = _mm_unpacklo_epi16(words, _mm_setzero_si128());
+                high = _mm_unpackhi_epi16(words, _mm_setzero_si128());
+            }
+
+            __m128 lowValues = _mm_div_ps(_mm_cvtepi32_ps(low), maximum);
+            __m128 highValues = _mm_div_ps(_mm_cvtepi32_ps(high), maximum);
+
+            if constexpr (isSigned)
+            {
+                lowValues = _mm_max_ps(lowValues, minimum);
+                highValues = _mm_max_ps(highValues, minimum);
+            }
+
+            _mm_storeu_ps(output + index, lowValues);
+            _mm_storeu_ps(output + index + 4, highValues);
+        }
+
+        return index;
+    }
+
+    template <typename Packed>
+    [[gnu::target("sse2")]] __m128i PackFieldSSE2(__m128 value, F32 maximum)
+    {
+        constexpr bool isSigned = std::is_same_v<Packed, Types::SNorm1010102>;
+
+        value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+        value = _mm_max_ps(value, _mm_set1_ps(isSigned ? -1.0f : 0.0f));
+        value = _mm_min_ps(value, _mm_set1_ps(1.0f));
+
+        return _mm_cvtps_epi32(_mm_mul_ps(value, _mm_set1_ps(maximum)));
+    }
+
+    template <typename Packed>
+    [[gnu::target("sse2")]] UI64 PackSSE2(const Types::Vec4<F32>* input, Packed* output, UI64 count)
+    {
+        constexpr bool isSigned = std::is_same_v<Packed, Types::SNorm1010102>;
+        constexpr F32 wideMaximum = isSigned ? 511.0f : 1023.0f;
+        constexpr F32 narrowMaximum = isSigned ? 1.0f : 3.0f;
+
+        const __m128i wideMask = _mm_set1_epi32(0x3FF);
+        const __m128i narrowMask = _mm_set1_epi32(0x3);
+
+        const auto* elements = reinterpret_cast<const F32*>(input);
+
+        UI64 index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            __m128 x = _mm_loadu_ps(elements + index * 4);
+            __m128 y = _mm_loadu_ps(elements + index * 4 + 4);
+            __m128 z = _mm_loadu_ps(elements + index * 4 + 8);
+            __m128 w = _mm_loadu_ps(elements + index * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128i r = _mm_and_si128(PackFieldSSE2<Packed>(x, wideMaximum), wideMask);
+            const __m128i g = _mm_and_si128(PackFieldSSE2<Packed>(y, wideMaximum), wideMask);
+            const __m128i b = _mm_and_si128(PackFieldSSE2<Packed>(z, wideMaximum), wideMask);
+            const __m128i a = _mm_and_si128(PackFieldSSE2<Packed>(w, narrowMaximum), narrowMask);
+
+            const __m128i packed = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 10)), _mm_or_si128(_mm_slli_epi32(b, 20), _mm_slli_epi32(a, 30)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), packed);
+        }
+
+        return index;
+    }
+
+    template <typename Packed>
+    [[gnu::target("sse2")]] UI64 UnpackSSE2(const Packed* input, Types::Vec4<F32>* output, UI64 count)
+    {
+        constexpr bool isSigned = std::is_same_v<Packed, Types::SNorm1010102>;
+
+        const __m128 wideMaximum = _mm_set1_ps(isSigned ? 511.0f : 1023.0f);
+        const __m128 narrowMaximum = _mm_set1_ps(isSigned ? 1.0f : 3.0f);
+        const __m128 minimum = _mm_set1_ps(-1.0f);
+
+        auto* elements = reinterpret_cast<F32*>(output);
+
+        UI64 index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+
+            __m128i r;
+            __m128i g;
+            __m128i b;
+            __m128i a;
+
+            if constexpr (isSigned)
+            {
+                r = _mm_srai_epi32(_mm_slli_epi32(packed, 22), 22);
+                g = _mm_srai_epi32(_mm_slli_epi32(packed, 12), 22);
+                b = _mm_srai_epi32(_mm_slli_epi32(packed, 2), 22);
+                a = _mm_srai_epi32(packed, 30);
+            }
+            else
+            {
+                const __m128i mask = _mm_set1_epi32(0x3FF);
+
+                r = _mm_and_si128(packed, mask);
+                g = _mm_and_si128(_mm_srli_epi32(packed, 10), mask);
+                b = _mm_and_si128(_mm_srli_epi32(packed, 20), mask);
+                a = _mm_srli_epi32(packed, 30);
+            }
+
+            __m128 x = _mm_div_ps(_mm_cvtepi32_ps(r), wideMaximum);
+            __m128 y = _mm_div_ps(_mm_cvtepi32_ps(g), wideMaximum);
+            __m128 z = _mm_div_ps(_mm_cvtepi32_ps(b), wideMaximum);
+            __m128 w = _mm_div_ps(_mm_cvtepi32_ps(a), narrowMaximum);
+
+            if constexpr (isSigned)
+            {
+                x = _mm_max_ps(x, minimum);
+                y = _mm_max_ps(y, minimum);
+                z = _mm_max_ps(z, minimum);
+                w = _mm_max_ps(w, minimum);
+            }
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            _mm_storeu_ps(elements + index * 4, x);
+            _mm_storeu_ps(elements + index * 4 + 4, y);
+            _mm_storeu_ps(elements + index * 4 + 8, z);
+            _mm_storeu_ps(elements + index * 4 + 12, w);
+        }
+
+        return index;
+    }
+#endif
+
+    void ConvertHalf(const F32* input, Types::F16* output, UI64 count)
+    {
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        switch (SIMD::GetInstructionSet())
+        {
+            case (SIMD::InstructionSet::AVX512):
+            {
+                index = FloatToHalfAVX512(input, output, count);
+
+                break;
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                index = FloatToHalfAVX2(input, output, count);
+
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+#endif
+
+        ConvertScalar(input + index, output + index, count - index);
+    }
+
+    void ConvertHalf(const Types::F16* input, F32* output, UI64 count)
+    {
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        switch (SIMD::GetInstructionSet())
+        {
+            case (SIMD::InstructionSet::AVX512):
+            {
+                index = HalfToFloatAVX512(input, output, count);
+
+                break;
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                index = HalfToFloatAVX2(input, output, count);
+
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+#endif
+
+        ConvertScalar(input + index, output + index, count - index);
+    }
+
+    template <typename T>
+    void EncodeNormalised(std::span<const F32> input, std::span<T> output)
+    {
+        ValidateCounts(input, output);
+
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        if (SIMD::GetInstructionSet() != SIMD::InstructionSet::Scalar)
+        {
+            index = EncodeNormalisedSSE2(input.data(), output.data(), input.size());
+        }
+#endif
+
+        ConvertScalar(input.data() + index, output.data() + index, input.size() - index);
+    }
+
+    template <typename T>
+    void DecodeNormalised(std::span<const T> input, std::span<F32> output)
+    {
+        ValidateCounts(input, output);
+
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        if (SIMD::GetInstructionSet() != SIMD::InstructionSet::Scalar)
+        {
+            index = DecodeNormalisedSSE2(input.data(), output.data(), input.size());
+        }
+#endif
+
+        ConvertScalar(input.data() + index, output.data() + index, input.size() - index);
+    }
+
+    template <typename Packed>
+    void Pack(std::span<const Types::Vec4<F32>> input, std::span<Packed> output)
+    {
+        ValidateCounts(input, output);
+
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        if (SIMD::GetInstructionSet() != SIMD::InstructionSet::Scalar)
+        {
+            index = PackSSE2(input.data(), output.data(), input.size());
+        }
+#endif
+
+        PackScalar(input.data() + index, output.data() + index, input.size() - index);
+    }
+
+    template <typename Packed>
+    void Unpack(std::span<const Packed> input, std::span<Types::Vec4<F32>> output)
+    {
+        ValidateCounts(input, output);
+
+        UI64 index = 0;
+
+#if defined(__x86_64__) or defined(__i386__)
+        if (SIMD::GetInstructionSet() != SIMD::InstructionSet::Scalar)
+        {
+            index = UnpackSSE2(input.data(), output.data(), input.size());
+        }
+#endif
+
+        UnpackScalar(input.data() + index, output.data() + index, input.size() - index);
+    }
+}
+
+namespace Mosaic::Internal::Conversions
+{
+    void Convert(std::span<const Types::F32> input, std::span<Types::F16> output)
+    {
+        Detail::ValidateCounts(input, output);
+
+        Detail::ConvertHalf(input.data(), output.data(), input.size());
+    }
+
+    void Convert(std::span<const Types::F16> input, std::span<Types::F32> output)
+    {
+        Detail::ValidateCounts(input, output);
+
+        Detail::ConvertHalf(input.data(), output.data(), input.size());
+    }
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::UNorm8> output)
+    {
+        Detail::EncodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::UNorm8> input, std::span<Types::F32> output)
+    {
+        Detail::DecodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::UNorm16> output)
+    {
+        Detail::EncodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::UNorm16> input, std::span<Types::F32> output)
+    {
+        Detail::DecodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::SNorm8> output)
+    {
+        Detail::EncodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::SNorm8> input, std::span<Types::F32> output)
+    {
+        Detail::DecodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::F32> input, std::span<Types::SNorm16> output)
+    {
+        Detail::EncodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::SNorm16> input, std::span<Types::F32> output)
+    {
+        Detail::DecodeNormalised(input, output);
+    }
+
+    void Convert(std::span<const Types::Vec4<Types::F32>> input, std::span<Types::UNorm1010102> output)
+    {
+        Detail::Pack(input, output);
+    }
+
+    void Convert(std::span<const Types::UNorm1010102> input, std::span<Types::Vec4<Types::F32>> output)
+    {
+        Detail::Unpack(input, output);
+    }
+
+    void Convert(std::span<const Types::Vec4<Types::F32>> input, std::span<Types::SNorm1010102> output)
+    {
+        Detail::Pack(input, output);
+    }
+
+    void Convert(std::span<const Types::SNorm1010102> input, std::span<Types::Vec4<Types::F32>> output)
+    {
+        Detail::Unpack(input, output);
+    }
+}
@@ -0,0 +1,461 @@
+#include "utilities/json.hpp"
+
+#include "application/console.hpp"
+
+#include <charconv>
+
+namespace Mosaic::Internal::Files
+{
+    class JsonParser
+    {
+    public:
+        JsonParser(std::string_view text)
+            : mText(text), mPosition(0)
+        {
+        }
+
+        JsonValue ParseDocument()
+        {
+            JsonValue value = ParseValue(0);
+
+            SkipWhitespace();
+
+            if (mPosition != mText.size())
+            {
+                Fail("Unexpected trailing characters");
+            }
+
+            return value;
+        }
+
+    private:
+        static constexpr Types::UI32 MaximumDepth = 256;
+
+        [[noreturn]] void Fail(const char* message) const
+        {
+            Console::Throw("Malformed JSON at offset {}: {}", mPosition, message);
+
+            throw;
+        }
+
+        void SkipWhitespace()
+        {
+            while (mPosition < mText.size() and (mText[mPosition] == ' ' or mText[mPosition] == '\t' or mText[mPosition] == '\n' or mText[mPosition] == '\r'))
+            {
+                mPosition++;
+            }
+        }
+
+        bool Consume(char expected)
+        {
+            SkipWhitespace();
+
+            if (mPosition < mText.size() and mText[mPosition] == expected)
+            {
+                mPosition++;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        void Expect(char expected)
+        {
+            if (not Consume(expected))
+            {
+                Fail("Unexpected character");
+            }
+        }
+
+        bool ConsumeLiteral(std::string_view literal)
+        {
+            if (mText.substr(mPosition, literal.size()) == literal)
+            {
+                mPosition += literal.size();
+
+                return true;
+            }
+
+            return false;
+        }
+
+        JsonValue ParseValue(Types::UI32 depth)
+        {
+            if (depth > MaximumDepth)
+            {
+                Fail("Nesting too deep");
+            }
+
+            SkipWhitespace();
+
+            if (mPosition >= mText.size())
+            {
+                Fail("Unexpected end of input");
+            }
+
+            JsonValue value;
+
+            const char next = mText[mPosition];
+
+            if (next == '{')
+            {
+                mPosition++;
+
+                JsonValue::Object object;
+
+                if (not Consume('}'))
+                {
+                    do
+                    {
+                        SkipWhitespace();
+
+                        std::string key = ParseString();
+
+                        Expect(':');
+
+                        object.emplace_back(std::move(key), ParseValue(depth + 1));
+                    } while (Consume(','));
+
+                    Expect('}');
+                }
+
+                value.mValue = std::move(object);
+            }
+            else if (next == '[')
+            {
+                mPosition++;
+
+                JsonValue::Array array;
+
+                if (not Consume(']'))
+                {
+                    do
+                    {
+                        array.push_back(ParseValue(depth + 1));
+                    } while (Consume(','));
+
+                    Expect(']');
+                }
+
+                value.mValue = std::move(array);
+            }
+            else if (next == '"')
+            {
+                value.mValue = ParseString();
+            }
+            else if (ConsumeLiteral("true"))
+            {
+                value.mValue = true;
+            }
+            else if (ConsumeLiteral("false"))
+            {
+                value.mValue = false;
+            }
+            else if (ConsumeLiteral("null"))
+            {
+                value.mValue = std::monostate{};
+            }
+            else
+            {
+                value.mValue = ParseNumber();
+            }
+
+            return value;
+        }
+
+        Types::F64 ParseNumber()
+        {
+            const char* first = mText.data() + mPosition;
+            const char* last = mText.data() + mText.size();
+
+            Types::F64 number = 0.0;
+
+            const auto [end, error] = std::from_chars(first, last, number);
+
+            if (error != std::errc() or end == first)
+            {
+                Fail("Invalid number");
+            }
+
+            mPosition += end - first;
+
+            return number;
+        }
+
+        void AppendCodepoint(std::string& out, Types::UI32 codepoint)
+        {
+            if (codepoint < 0x80)
+            {
+                out.push_back(static_cast<char>(codepoint));
+            }
+            else if (codepoint < 0x800)
+            {
+                out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+            else if (codepoint < 0x10000)
+            {
+                out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+            else
+            {
+                out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+        }
+
+        Types::UI32 ParseHexQuad()
+        {
+            if (mPosition + 4 > mText.size())
+            {
+                Fail("Truncated unicode escape");
+            }
+
+            Types::UI32 codepoint = 0;
+
+            const auto [end, error] = std::from_chars(mText.data() + mPosition, mText.data() + mPosition + 4, codepoint, 16);
+
+            if (error != std::errc() or end != mText.data() + mPosition + 4)
+            {
+                Fail("Invalid unicode escape");
+            }
+
+            mPosition += 4;
+
+            return codepoint;
+        }
+
+        std::string ParseString()
+        {
+            if (mPosition >= mText.size() or mText[mPosition] != '"')
+            {
+                Fail("Expected string");
+            }
+
+            mPosition++;
+
+            std::string out;
+
+            while (true)
+            {
+                const Types::UI64 run = mText.find_first_of("\"\\", mPosition);
+
+                if (run == std::string_view::npos)
+                {
+                    Fail("Unterminated string");
+                }
+
+                out.append(mText.substr(mPosition, run - mPosition));
+
+                mPosition = run + 1;
+
+                if (mText[run] == '"')
+                {
+                    return out;
+                }
+
+                if (mPosition >= mText.size())
+                {
+                    Fail("Unterminated escape");
+                }
+
+                const char escape = mText[mPosition++];
+
+                switch (escape)
+                {
+                    case ('"'):
+                    case ('\\'):
+                    case ('/'):
+                    {
+                        out.push_back(escape);
+                        break;
+                    }
+                    case ('b'):
+                    {
+                        out.push_back('\b');
+                        break;
+                    }
+                    case ('f'):
+                    {
+                        out.push_back('\f');
+                        break;
+                    }
+                    case ('n'):
+                    {
+                        out.push_back('\n');
+                        break;
+                    }
+                    case ('r'):
+                    {
+                        out.push_back('\r');
+                        break;
+                    }
+                    case ('t'):
+                    {
+                        out.push_back('\t');
+                        break;
+                    }
+                    case ('u'):
+                    {
+                        Types::UI32 codepoint = ParseHexQuad();
+
+                        if (codepoint >= 0xD800 and codepoint < 0xDC00 and ConsumeLiteral("\\u"))
+                        {
+                            const Types::UI32 low = ParseHexQuad();
+
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                        }
+
+                        AppendCodepoint(out, codepoint);
+                        break;
+                    }
+                    default:
+                    {
+                        Fail("Invalid escape");
+                    }
+                }
+            }
+        }
+
+        std::string_view mText;
+        Types::UI64 mPosition;
+    };
+
+    JsonValue JsonValue::Parse(std::string_view text)
+    {
+        return JsonParser(text).ParseDocument();
+    }
+
+    bool JsonValue::IsNull() const
+    {
+        return std::holds_alternative<std::monostate>(mValue);
+    }
+
+    bool JsonValue::IsBool() const
+    {
+        return std::holds_alternative<bool>(mValue);
+    }
+
+    bool JsonValue::IsNumber() const
+    {
+        return std::holds_alternative<Types::F64>(mValue);
+    }
+
+    bool JsonValue::IsString() const
+    {
+        return std::holds_alternative<std::string>(mValue);
+    }
+
+    bool JsonValue::IsArray() const
+    {
+        return std::holds_alternative<Array>(mValue);
+    }
+
+    bool JsonValue::IsObject() const
+    {
+        return std::holds_alternative<Object>(mValue);
+    }
+
+    bool JsonValue::Contains(std::string_view key) const
+    {
+        return not (*this)[key].IsNull();
+    }
+
+    const JsonValue& JsonValue::operator[](std::string_view key) const
+    {
+        static const JsonValue null;
+
+        if (const Object* object = std::get_if<Object>(&mValue))
+        {
+            for (const auto& [name, value] : *object)
+            {
+                if (name == key)
+                {
+                    return value;
+                }
+            }
+        }
+
+        return null;
+    }
+
+    const JsonValue& JsonValue::operator[](Types::UI64 index) const
+    {
+        static const JsonValue null;
+
+        if (const Array* array = std::get_if<Array>(&mValue); array and index < array->size())
+        {
+            return (*array)[index];
+        }
+
+        return null;
+    }
+
+    Types::UI64 JsonValue::Size() const
+    {
+        if (const Array* array = std::get_if<Array>(&mValue))
+        {
+            return array->size();
+        }
+
+        if (const Object* object = std::get_if<Object>(&mValue))
+        {
+            return object->size();
+        }
+
+        return 0;
+    }
+
+    bool JsonValue::AsBool(bool fallback) const
+    {
+        const bool* value = std::get_if<bool>(&mValue);
+
+        return value ? *value : fallback;
+    }
+
+    Types::F64 JsonValue::AsNumber(Types::F64 fallback) const
+    {
+        const Types::F64* value = std::get_if<Types::F64>(&mValue);
+
+        return value ? *value : fallback;
+    }
+
+    Types::UI64 JsonValue::AsUnsigned(Types::UI64 fallback) const
+    {
+        const Types::F64* value = std::get_if<Types::F64>(&mValue);
+
+        return value and *value >= 0.0 ? static_cast<Types::UI64>(*value) : fallback;
+    }
+
+    const std::string& JsonValue::AsString() const
+    {
+        static const std::string empty;
+
+        const std::string* value = std::get_if<std::string>(&mValue);
+
+        return value ? *value : empty;
+    }
+
+    const JsonValue::Array& JsonValue::AsArray() const
+    {
+        static const Array empty;
+
+        const Array* value = std::get_if<Array>(&mValue);
+
+        return value ? *value : empty;
+    }
+
+    const JsonValue::Object& JsonValue::AsObject() const
+    {
+        static const Object empty;
+
+        const Object* value = std::get_if<Object>(&mValue);
+
+        return value ? *value : empty;
+    }
+}
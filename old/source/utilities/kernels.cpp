@@ -0,0 +1,599 @@
+#include "utilities/kernels.hpp"
+#include "utilities/simd.hpp"
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace Mosaic::Internal::Kernels::Detail
+{
+#if defined(__x86_64__) or defined(__i386__)
+    using Types::F32;
+    using Types::UI64;
+
+    [[gnu::target("sse2")]] void TransformSSE2(const AffineTransform<F32>& transform, ConstVec3Lanes<F32> input, Vec3Lanes<F32> output)
+    {
+        const auto& m = transform.Elements;
+
+        const UI64 count = input.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 x = _mm_loadu_ps(&input.X[index]);
+            const __m128 y = _mm_loadu_ps(&input.Y[index]);
+            const __m128 z = _mm_loadu_ps(&input.Z[index]);
+
+            const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[1]), y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[2]), z), _mm_set1_ps(m[3])));
+            const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[4]), x), _mm_mul_ps(_mm_set1_ps(m[5]), y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[6]), z), _mm_set1_ps(m[7])));
+            const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[8]), x), _mm_mul_ps(_mm_set1_ps(m[9]), y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[10]), z), _mm_set1_ps(m[11])));
+
+            _mm_storeu_ps(&output.X[index], rx);
+            _mm_storeu_ps(&output.Y[index], ry);
+            _mm_storeu_ps(&output.Z[index], rz);
+        }
+
+        TransformScalar(transform, input.Subspan(index), output.Subspan(index));
+    }
+
+    [[gnu::target("avx2,fma")]] void TransformAVX2(const AffineTransform<F32>& transform, ConstVec3Lanes<F32> input, Vec3Lanes<F32> output)
+    {
+        const auto& m = transform.Elements;
+
+        const UI64 count = input.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(&input.X[index]);
+            const __m256 y = _mm256_loadu_ps(&input.Y[index]);
+            const __m256 z = _mm256_loadu_ps(&input.Z[index]);
+
+            const __m256 rx = _mm256_fmadd_ps(_mm256_set1_ps(m[0]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[1]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[2]), z, _mm256_set1_ps(m[3]))));
+            const __m256 ry = _mm256_fmadd_ps(_mm256_set1_ps(m[4]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[5]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[6]), z, _mm256_set1_ps(m[7]))));
+            const __m256 rz = _mm256_fmadd_ps(_mm256_set1_ps(m[8]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[9]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[10]), z, _mm256_set1_ps(m[11]))));
+
+            _mm256_storeu_ps(&output.X[index], rx);
+            _mm256_storeu_ps(&output.Y[index], ry);
+            _mm256_storeu_ps(&output.Z[index], rz);
+        }
+
+        TransformScalar(transform, input.Subspan(index), output.Subspan(index));
+    }
+
+    [[gnu::target("avx512f")]] void TransformAVX512(const AffineTransform<F32>& transform, ConstVec3Lanes<F32> input, Vec3Lanes<F32> output)
+    {
+        const auto& m = transform.Elements;
+
+        const UI64 count = input.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            const __m512 x = _mm512_loadu_ps(&input.X[index]);
+            const __m512 y = _mm512_loadu_ps(&input.Y[index]);
+            const __m512 z = _mm512_loadu_ps(&input.Z[index]);
+
+            const __m512 rx = _mm512_fmadd_ps(_mm512_set1_ps(m[0]), x, _mm512_fmadd_ps(_mm512_set1_ps(m[1]), y, _mm512_fmadd_ps(_mm512_set1_ps(m[2]), z, _mm512_set1_ps(m[3]))));
+            const __m512 ry = _mm512_fmadd_ps(_mm512_set1_ps(m[4]), x, _mm512_fmadd_ps(_mm512_set1_ps(m[5]), y, _mm512_fmadd_ps(_mm512_set1_ps(m[6]), z, _mm512_set1_ps(m[7]))));
+            const __m512 rz = _mm512_fmadd_ps(_mm512_set1_ps(m[8]), x, _mm512_fmadd_ps(_mm512_set1_ps(m[9]), y, _mm512_fmadd_ps(_mm512_set1_ps(m[10]), z, _mm512_set1_ps(m[11]))));
+
+            _mm512_storeu_ps(&output.X[index], rx);
+            _mm512_storeu_ps(&output.Y[index], ry);
+            _mm512_storeu_ps(&output.Z[index], rz);
+        }
+
+        TransformScalar(transform, input.Subspan(index), output.Subspan(index));
+    }
+
+    [[gnu::target("sse2")]] void IntegrateVelocitySSE2(Vec3Lanes<F32> positions, ConstVec3Lanes<F32> velocities, F32 deltaTime)
+    {
+        const __m128 step = _mm_set1_ps(deltaTime);
+
+        const UI64 count = positions.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            _mm_storeu_ps(&positions.X[index], _mm_add_ps(_mm_loadu_ps(&positions.X[index]), _mm_mul_ps(_mm_loadu_ps(&velocities.X[index]), step)));
+            _mm_storeu_ps(&positions.Y[index], _mm_add_ps(_mm_loadu_ps(&positions.Y[index]), _mm_mul_ps(_mm_loadu_ps(&velocities.Y[index]), step)));
+            _mm_storeu_ps(&positions.Z[index], _mm_add_ps(_mm_loadu_ps(&positions.Z[index]), _mm_mul_ps(_mm_loadu_ps(&velocities.Z[index]), step)));
+        }
+
+        IntegrateVelocityScalar(positions.Subspan(index), velocities.Subspan(index), deltaTime);
+    }
+
+    [[gnu::target("avx2,fma")]] void IntegrateVelocityAVX2(Vec3Lanes<F32> positions, ConstVec3Lanes<F32> velocities, F32 deltaTime)
+    {
+        const __m256 step = _mm256_set1_ps(deltaTime);
+
+        const UI64 count = positions.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            _mm256_storeu_ps(&positions.X[index], _mm256_fmadd_ps(_mm256_loadu_ps(&velocities.X[index]), step, _mm256_loadu_ps(&positions.X[index])));
+            _mm256_storeu_ps(&positions.Y[index], _mm256_fmadd_ps(_mm256_loadu_ps(&velocities.Y[index]), step, _mm256_loadu_ps(&positions.Y[index])));
+            _mm256_storeu_ps(&positions.Z[index], _mm256_fmadd_ps(_mm256_loadu_ps(&velocities.Z[index]), step, _mm256_loadu_ps(&positions.Z[index])));
+        }
+
+        IntegrateVelocityScalar(positions.Subspan(index), velocities.Subspan(index), deltaTime);
+    }
+
+    [[gnu::target("avx512f")]] void IntegrateVelocityAVX512(Vec3Lanes<F32> positions, ConstVec3Lanes<F32> velocities, F32 deltaTime)
+    {
+        const __m512 step = _mm512_set1_ps(deltaTime);
+
+        const UI64 count = positions.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            _mm512_storeu_ps(&positions.X[index], _mm512_fmadd_ps(_mm512_loadu_ps(&velocities.X[index]), step, _mm512_loadu_ps(&positions.X[index])));
+            _mm512_storeu_ps(&positions.Y[index], _mm512_fmadd_ps(_mm512_loadu_ps(&velocities.Y[index]), step, _mm512_loadu_ps(&positions.Y[index])));
+            _mm512_storeu_ps(&positions.Z[index], _mm512_fmadd_ps(_mm512_loadu_ps(&velocities.Z[index]), step, _mm512_loadu_ps(&positions.Z[index])));
+        }
+
+        IntegrateVelocityScalar(positions.Subspan(index), velocities.Subspan(index), deltaTime);
+    }
+
+    [[gnu::target("sse2")]] F32 HorizontalMinSSE2(__m128 value)
+    {
+        value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+        value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        return _mm_cvtss_f32(value);
+    }
+
+    [[gnu::target("sse2")]] F32 HorizontalMaxSSE2(__m128 value)
+    {
+        value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+        value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        return _mm_cvtss_f32(value);
+    }
+
+    [[gnu::target("sse2")]] Bounds<F32> ComputeBoundsSSE2(ConstVec3Lanes<F32> points)
+    {
+        Bounds<F32> bounds = EmptyBounds<F32>();
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        if (count >= 4)
+        {
+            __m128 minX = _mm_loadu_ps(&points.X[0]);
+            __m128 minY = _mm_loadu_ps(&points.Y[0]);
+            __m128 minZ = _mm_loadu_ps(&points.Z[0]);
+
+            __m128 maxX = minX;
+            __m128 maxY = minY;
+            __m128 maxZ = minZ;
+
+            for (index = 4; index + 4 <= count; index += 4)
+            {
+                const __m128 x = _mm_loadu_ps(&points.X[index]);
+                const __m128 y = _mm_loadu_ps(&points.Y[index]);
+                const __m128 z = _mm_loadu_ps(&points.Z[index]);
+
+                minX = _mm_min_ps(minX, x);
+                minY = _mm_min_ps(minY, y);
+                minZ = _mm_min_ps(minZ, z);
+
+                maxX = _mm_max_ps(maxX, x);
+                maxY = _mm_max_ps(maxY, y);
+                maxZ = _mm_max_ps(maxZ, z);
+            }
+
+            bounds.Min = {HorizontalMinSSE2(minX), HorizontalMinSSE2(minY), HorizontalMinSSE2(minZ)};
+            bounds.Max = {HorizontalMaxSSE2(maxX), HorizontalMaxSSE2(maxY), HorizontalMaxSSE2(maxZ)};
+        }
+
+        return ComputeBoundsScalar(points.Subspan(index), bounds);
+    }
+
+    [[gnu::target("avx2,fma")]] F32 HorizontalMinAVX2(__m256 value)
+    {
+        return HorizontalMinSSE2(_mm_min_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+    }
+
+    [[gnu::target("avx2,fma")]] F32 HorizontalMaxAVX2(__m256 value)
+    {
+        return HorizontalMaxSSE2(_mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+    }
+
+    [[gnu::target("avx2,fma")]] Bounds<F32> ComputeBoundsAVX2(ConstVec3Lanes<F32> points)
+    {
+        Bounds<F32> bounds = EmptyBounds<F32>();
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        if (count >= 8)
+        {
+            __m256 minX = _mm256_loadu_ps(&points.X[0]);
+            __m256 minY = _mm256_loadu_ps(&points.Y[0]);
+            __m256 minZ = _mm256_loadu_ps(&points.Z[0]);
+
+            __m256 maxX = minX;
+            __m256 maxY = minY;
+            __m256 maxZ = minZ;
+
+            for (index = 8; index + 8 <= count; index += 8)
+            {
+                const __m256 x = _mm256_loadu_ps(&points.X[index]);
+                const __m256 y = _mm256_loadu_ps(&points.Y[index]);
+                const __m256 z = _mm256_loadu_ps(&points.Z[index]);
+
+                minX = _mm256_min_ps(minX, x);
+                minY = _mm256_min_ps(minY, y);
+                minZ = _mm256_min_ps(minZ, z);
+
+                maxX = _mm256_max_ps(maxX, x);
+                maxY = _mm256_max_ps(maxY, y);
+                maxZ = _mm256_max_ps(maxZ, z);
+            }
+
+            bounds.Min = {HorizontalMinAVX2(minX), HorizontalMinAVX2(minY), HorizontalMinAVX2(minZ)};
+            bounds.Max = {HorizontalMaxAVX2(maxX), HorizontalMaxAVX2(maxY), HorizontalMaxAVX2(maxZ)};
+        }
+
+        return ComputeBoundsScalar(points.Subspan(index), bounds);
+    }
+
+    [[gnu::target("avx512f")]] Bounds<F32> ComputeBoundsAVX512(ConstVec3Lanes<F32> points)
+    {
+        Bounds<F32> bounds = EmptyBounds<F32>();
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        if (count >= 16)
+        {
+            __m512 minX = _mm512_loadu_ps(&points.X[0]);
+            __m512 minY = _mm512_loadu_ps(&points.Y[0]);
+            __m512 minZ = _mm512_loadu_ps(&points.Z[0]);
+
+            __m512 maxX = minX;
+            __m512 maxY = minY;
+            __m512 maxZ = minZ;
+
+            for (index = 16; index + 16 <= count; index += 16)
+            {
+                const __m512 x = _mm512_loadu_ps(&points.X[index]);
+                const __m512 y = _mm512_loadu_ps(&points.Y[index]);
+                const __m512 z = _mm512_loadu_ps(&points.Z[index]);
+
+                minX = _mm512_min_ps(minX, x);
+                minY = _mm512_min_ps(minY, y);
+                minZ = _mm512_min_ps(minZ, z);
+
+                maxX = _mm512_max_ps(maxX, x);
+                maxY = _mm512_max_ps(maxY, y);
+                maxZ = _mm512_max_ps(maxZ, z);
+            }
+
+            bounds.Min = {_mm512_reduce_min_ps(minX), _mm512_reduce_min_ps(minY), _mm512_reduce_min_ps(minZ)};
+            bounds.Max = {_mm512_reduce_max_ps(maxX), _mm512_reduce_max_ps(maxY), _mm512_reduce_max_ps(maxZ)};
+        }
+
+        return ComputeBoundsScalar(points.Subspan(index), bounds);
+    }
+
+    [[gnu::target("sse2")]] void DistanceSquaredSSE2(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, std::span<F32> output)
+    {
+        const __m128 ox = _mm_set1_ps(origin.X);
+        const __m128 oy = _mm_set1_ps(origin.Y);
+        const __m128 oz = _mm_set1_ps(origin.Z);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&points.X[index]), ox);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&points.Y[index]), oy);
+            const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&points.Z[index]), oz);
+
+            _mm_storeu_ps(&output[index], _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+        }
+
+        DistanceSquaredScalar(points.Subspan(index), origin, output.subspan(index));
+    }
+
+    [[gnu::target("avx2,fma")]] void DistanceSquaredAVX2(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, std::span<F32> output)
+    {
+        const __m256 ox = _mm256_set1_ps(origin.X);
+        const __m256 oy = _mm256_set1_ps(origin.Y);
+        const __m256 oz = _mm256_set1_ps(origin.Z);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&points.X[index]), ox);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&points.Y[index]), oy);
+            const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(&points.Z[index]), oz);
+
+            _mm256_storeu_ps(&output[index], _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz))));
+        }
+
+        DistanceSquaredScalar(points.Subspan(index), origin, output.subspan(index));
+    }
+
+    [[gnu::target("avx512f")]] void DistanceSquaredAVX512(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, std::span<F32> output)
+    {
+        const __m512 ox = _mm512_set1_ps(origin.X);
+        const __m512 oy = _mm512_set1_ps(origin.Y);
+        const __m512 oz = _mm512_set1_ps(origin.Z);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            const __m512 dx = _mm512_sub_ps(_mm512_loadu_ps(&points.X[index]), ox);
+            const __m512 dy = _mm512_sub_ps(_mm512_loadu_ps(&points.Y[index]), oy);
+            const __m512 dz = _mm512_sub_ps(_mm512_loadu_ps(&points.Z[index]), oz);
+
+            _mm512_storeu_ps(&output[index], _mm512_fmadd_ps(dx, dx, _mm512_fmadd_ps(dy, dy, _mm512_mul_ps(dz, dz))));
+        }
+
+        DistanceSquaredScalar(points.Subspan(index), origin, output.subspan(index));
+    }
+
+    void WriteMask(Types::UI8* mask, Types::UI32 bits, Types::UI32 width)
+    {
+        for (Types::UI32 lane = 0; lane < width; lane++)
+        {
+            mask[lane] = (bits >> lane) & 1;
+        }
+    }
+
+    [[gnu::target("sse2")]] UI64 WithinDistanceSSE2(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, F32 radius, std::span<Types::UI8> mask)
+    {
+        const __m128 ox = _mm_set1_ps(origin.X);
+        const __m128 oy = _mm_set1_ps(origin.Y);
+        const __m128 oz = _mm_set1_ps(origin.Z);
+        const __m128 limit = _mm_set1_ps(radius * radius);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+        UI64 inside = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&points.X[index]), ox);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&points.Y[index]), oy);
+            const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&points.Z[index]), oz);
+
+            const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+            const Types::UI32 bits = _mm_movemask_ps(_mm_cmple_ps(distance, limit));
+
+            WriteMask(&mask[index], bits, 4);
+
+            inside += __builtin_popcount(bits);
+        }
+
+        return inside + WithinDistanceScalar(points.Subspan(index), origin, radius, mask.subspan(index));
+    }
+
+    [[gnu::target("avx2,fma")]] UI64 WithinDistanceAVX2(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, F32 radius, std::span<Types::UI8> mask)
+    {
+        const __m256 ox = _mm256_set1_ps(origin.X);
+        const __m256 oy = _mm256_set1_ps(origin.Y);
+        const __m256 oz = _mm256_set1_ps(origin.Z);
+        const __m256 limit = _mm256_set1_ps(radius * radius);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+        UI64 inside = 0;
+
+        for (; index + 8 <= count; index += 8)
+        {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&points.X[index]), ox);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&points.Y[index]), oy);
+            const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(&points.Z[index]), oz);
+
+            const __m256 distance = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+
+            const Types::UI32 bits = _mm256_movemask_ps(_mm256_cmp_ps(distance, limit, _CMP_LE_OQ));
+
+            WriteMask(&mask[index], bits, 8);
+
+            inside += __builtin_popcount(bits);
+        }
+
+        return inside + WithinDistanceScalar(points.Subspan(index), origin, radius, mask.subspan(index));
+    }
+
+    [[gnu::target("avx512f")]] UI64 WithinDistanceAVX512(ConstVec3Lanes<F32> points, const Types::Vec3<F32>& origin, F32 radius, std::span<Types::UI8> mask)
+    {
+        const __m512 ox = _mm512_set1_ps(origin.X);
+        const __m512 oy = _mm512_set1_ps(origin.Y);
+        const __m512 oz = _mm512_set1_ps(origin.Z);
+        const __m512 limit = _mm512_set1_ps(radius * radius);
+
+        const UI64 count = points.X.size();
+
+        UI64 index = 0;
+        UI64 inside = 0;
+
+        for (; index + 16 <= count; index += 16)
+        {
+            const __m512 dx = _mm512_sub_ps(_mm512_loadu_ps(&points.X[index]), ox);
+            const __m512 dy = _mm512_sub_ps(_mm512_loadu_ps(&points.Y[index]), oy);
+            const __m512 dz = _mm512_sub_ps(_mm512_loadu_ps(&points.Z[index]), oz);
+
+            const __m512 distance = _mm512_fmadd_ps(dx, dx, _mm512_fmadd_ps(dy, dy, _mm512_mul_ps(dz, dz)));
+
+            const Types::UI32 bits = _mm512_cmp_ps_mask(distance, limit, _CMP_LE_OQ);
+
+            WriteMask(&mask[index], bits, 16);
+
+            inside += __builtin_popcount(bits);
+        }
+
+        return inside + WithinDistanceScalar(points.Subspan(index), origin, radius, mask.subspan(index));
+    }
+#endif
+}
+
+namespace Mosaic::Internal::Kernels
+{
+    template <>
+    void Transform<Types::F32>(const AffineTransform<Types::F32>& transform, ConstVec3Lanes<Types::F32> input, Vec3Lanes<Types::F32> output)
+    {
+        Detail::ValidateLaneCounts(input.Size(), output.Size());
+
+        switch (SIMD::GetInstructionSet())
+        {
+#if defined(__x86_64__) or defined(__i386__)
+            case (SIMD::InstructionSet::AVX512):
+            {
+                return Detail::TransformAVX512(transform, input, output);
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                return Detail::TransformAVX2(transform, input, output);
+            }
+            case (SIMD::InstructionSet::SSE2):
+            {
+                return Detail::TransformSSE2(transform, input, output);
+            }
+#endif
+            default:
+            {
+                return Detail::TransformScalar(transform, input, output);
+            }
+        }
+    }
+
+    template <>
+    void IntegrateVelocity<Types::F32>(Vec3Lanes<Types::F32> positions, ConstVec3Lanes<Types::F32> velocities, Types::F32 deltaTime)
+    {
+        Detail::ValidateLaneCounts(positions.Size(), velocities.Size());
+
+        switch (SIMD::GetInstructionSet())
+        {
+#if defined(__x86_64__) or defined(__i386__)
+            case (SIMD::InstructionSet::AVX512):
+            {
+                return Detail::IntegrateVelocityAVX512(positions, velocities, deltaTime);
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                return Detail::IntegrateVelocityAVX2(positions, velocities, deltaTime);
+            }
+            case (SIMD::InstructionSet::SSE2):
+            {
+                return Detail::IntegrateVelocitySSE2(positions, velocities, deltaTime);
+            }
+#endif
+            default:
+            {
+                return Detail::IntegrateVelocityScalar(positions, velocities, deltaTime);
+            }
+        }
+    }
+
+    template <>
+    Bounds<Types::F32> ComputeBounds<Types::F32>(ConstVec3Lanes<Types::F32> points)
+    {
+        points.Size();
+
+        switch (SIMD::GetInstructionSet())
+        {
+#if defined(__x86_64__) or defined(__i386__)
+            case (SIMD::InstructionSet::AVX512):
+            {
+                return Detail::ComputeBoundsAVX512(points);
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                return Detail::ComputeBoundsAVX2(points);
+            }
+            case (SIMD::InstructionSet::SSE2):
+            {
+                return Detail::ComputeBoundsSSE2(points);
+            }
+#endif
+            default:
+            {
+                return Detail::ComputeBoundsScalar(points, Detail::EmptyBounds<Types::F32>());
+            }
+        }
+    }
+
+    template <>
+    void DistanceSquared<Types::F32>(ConstVec3Lanes<Types::F32> points, const Types::Vec3<Types::F32>& origin, std::span<Types::F32> output)
+    {
+        Detail::ValidateLaneCounts(points.Size(), output.size());
+
+        switch (SIMD::GetInstructionSet())
+        {
+#if defined(__x86_64__) or defined(__i386__)
+            case (SIMD::InstructionSet::AVX512):
+            {
+                return Detail::DistanceSquaredAVX512(points, origin, output);
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                return Detail::DistanceSquaredAVX2(points, origin, output);
+            }
+            case (SIMD::InstructionSet::SSE2):
+            {
+                return Detail::DistanceSquaredSSE2(points, origin, output);
+            }
+#endif
+            default:
+            {
+                return Detail::DistanceSquaredScalar(points, origin, output);
+            }
+        }
+    }
+
+    template <>
+    Types::UI64 WithinDistance<Types::F32>(ConstVec3Lanes<Types::F32> points, const Types::Vec3<Types::F32>& origin, Types::F32 radius, std::span<Types::UI8> mask)
+    {
+        Detail::ValidateLaneCounts(points.Size(), mask.size());
+
+        switch (SIMD::GetInstructionSet())
+        {
+#if defined(__x86_64__) or defined(__i386__)
+            case (SIMD::InstructionSet::AVX512):
+            {
+                return Detail::WithinDistanceAVX512(points, origin, radius, mask);
+            }
+            case (SIMD::InstructionSet::AVX2):
+            {
+                return Detail::WithinDistanceAVX2(points, origin, radius, mask);
+            }
+            case (SIMD::InstructionSet::SSE2):
+            {
+                return Detail::WithinDistanceSSE2(points, origin, radius, mask);
+            }
+#endif
+            default:
+            {
+                return Detail::WithinDistanceScalar(points, origin, radius, mask);
+            }
+        }
+    }
+}
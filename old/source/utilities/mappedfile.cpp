@@ -0,0 +1,179 @@
+#include "utilities/mappedfile.hpp"
+
+#include "application/console.hpp"
+
+#include <utility>
+
+#ifdef WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mosaic::Internal::Files
+{
+    MappedFile::MappedFile(const std::string& path)
+    {
+        Open(path);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+
+            mData = std::exchange(other.mData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+
+#ifdef WINDOWS
+            mFileHandle = std::exchange(other.mFileHandle, nullptr);
+            mMappingHandle = std::exchange(other.mMappingHandle, nullptr);
+#endif
+        }
+
+        return *this;
+    }
+
+#ifdef WINDOWS
+    void MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            Console::Throw("Failed to open file for mapping: {}", path);
+        }
+
+        LARGE_INTEGER size;
+
+        if (not GetFileSizeEx(file, &size) or size.QuadPart == 0)
+        {
+            CloseHandle(file);
+
+            Console::Throw("Cannot map empty or unreadable file: {}", path);
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (not mapping)
+        {
+            CloseHandle(file);
+
+            Console::Throw("Failed to create file mapping: {}", path);
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (not view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+
+            Console::Throw("Failed to map view of file: {}", path);
+        }
+
+        mFileHandle = file;
+        mMappingHandle = mapping;
+
+        mData = static_cast<const std::byte*>(view);
+        mSize = size.QuadPart;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mData)
+        {
+            UnmapViewOfFile(mData);
+        }
+
+        if (mMappingHandle)
+        {
+            CloseHandle(mMappingHandle);
+        }
+
+        if (mFileHandle)
+        {
+            CloseHandle(mFileHandle);
+        }
+
+        mData = nullptr;
+        mSize = 0;
+
+        mFileHandle = nullptr;
+        mMappingHandle = nullptr;
+    }
+#else
+    void MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        const int descriptor = open(path.c_str(), O_RDONLY);
+
+        if (descriptor < 0)
+        {
+            Console::Throw("Failed to open file for mapping: {}", path);
+        }
+
+        struct stat status;
+
+        if (fstat(descriptor, &status) != 0 or status.st_size == 0)
+        {
+            close(descriptor);
+
+            Console::Throw("Cannot map empty or unreadable file: {}", path);
+        }
+
+        void* view = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        close(descriptor);
+
+        if (view == MAP_FAILED)
+        {
+            Console::Throw("Failed to map file: {}", path);
+        }
+
+        madvise(view, status.st_size, MADV_WILLNEED);
+
+        mData = static_cast<const std::byte*>(view);
+        mSize = status.st_size;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mData)
+        {
+            munmap(const_cast<std::byte*>(mData), mSize);
+        }
+
+        mData = nullptr;
+        mSize = 0;
+    }
+#endif
+
+    bool MappedFile::IsOpen() const
+    {
+        return mData != nullptr;
+    }
+
+    std::span<const std::byte> MappedFile::GetData() const
+    {
+        return {mData, mSize};
+    }
+}
@@ -0,0 +1,143 @@
+#include "utilities/memory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace Mosaic::Internal::Memory::Detail
+{
+    template <Types::UI64 Size>
+    void StridedCopyFixed(std::byte* destination, Types::UI64 destinationStride, const std::byte* source, Types::UI64 sourceStride, Types::UI64 count)
+    {
+        for (Types::UI64 index = 0; index < count; index++)
+        {
+            std::memcpy(destination, source, Size);
+
+            destination += destinationStride;
+            source += sourceStride;
+        }
+    }
+}
+
+namespace Mosaic::Internal::Memory
+{
+    void StridedCopy(std::byte* destination, Types::UI64 destinationStride, const std::byte* source, Types::UI64 sourceStride, Types::UI64 elementSize, Types::UI64 count)
+    {
+        if (destinationStride == elementSize and sourceStride == elementSize)
+        {
+            std::memcpy(destination, source, elementSize * count);
+
+            return;
+        }
+
+        switch (elementSize)
+        {
+            case (1):
+            {
+                return Detail::StridedCopyFixed<1>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (2):
+            {
+                return Detail::StridedCopyFixed<2>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (4):
+            {
+                return Detail::StridedCopyFixed<4>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (8):
+            {
+                return Detail::StridedCopyFixed<8>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (12):
+            {
+                return Detail::StridedCopyFixed<12>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (16):
+            {
+                return Detail::StridedCopyFixed<16>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (24):
+            {
+                return Detail::StridedCopyFixed<24>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (32):
+            {
+                return Detail::StridedCopyFixed<32>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (48):
+            {
+                return Detail::StridedCopyFixed<48>(destination, destinationStride, source, sourceStride, count);
+            }
+            case (64):
+            {
+                return Detail::StridedCopyFixed<64>(destination, destinationStride, source, sourceStride, count);
+            }
+            default:
+            {
+                for (Types::UI64 index = 0; index < count; index++)
+                {
+                    std::memcpy(destination + index * destinationStride, source + index * sourceStride, elementSize);
+                }
+            }
+        }
+    }
+
+    LinearAllocator::LinearAllocator(Types::UI64 blockSize)
+        : mBlockIndex(0), mOffset(0), mBlockSize(blockSize), mUsedBytes(0)
+    {
+    }
+
+    void* LinearAllocator::Allocate(Types::UI64 size, Types::UI64 alignment)
+    {
+        while (mBlockIndex < mBlocks.size())
+        {
+            Block& block = mBlocks[mBlockIndex];
+
+            const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.Data.get());
+            const std::uintptr_t aligned = (base + mOffset + alignment - 1) & ~(alignment - 1);
+
+            if (aligned + size <= base + block.Size)
+            {
+                mOffset = aligned + size - base;
+                mUsedBytes += size;
+
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            mBlockIndex++;
+            mOffset = 0;
+        }
+
+        const Types::UI64 blockSize = std::max(mBlockSize, size + alignment);
+
+        mBlocks.push_back({std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize});
+
+        mBlockIndex = mBlocks.size() - 1;
+
+        return Allocate(size, alignment);
+    }
+
+    void LinearAllocator::Reset()
+    {
+        mBlockIndex = 0;
+        mOffset = 0;
+        mUsedBytes = 0;
+    }
+
+    Types::UI64 LinearAllocator::GetUsedBytes() const
+    {
+        return mUsedBytes;
+    }
+
+    Types::UI64 LinearAllocator::GetReservedBytes() const
+    {
+        Types::UI64 total = 0;
+
+        for (const Block& block : mBlocks)
+        {
+            total += block.Size;
+        }
+
+        return total;
+    }
+}
@@ -0,0 +1,35 @@
+#include "utilities/simd.hpp"
+
+namespace Mosaic::Internal::SIMD
+{
+    InstructionSet DetectInstructionSet()
+    {
+#if defined(__x86_64__) or defined(__i386__)
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return InstructionSet::AVX512;
+        }
+
+        if (__builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma") and __builtin_cpu_supports("f16c"))
+        {
+            return InstructionSet::AVX2;
+        }
+
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return InstructionSet::SSE2;
+        }
+#endif
+
+        return InstructionSet::Scalar;
+    }
+
+    InstructionSet GetInstructionSet()
+    {
+        static const InstructionSet instructionSet = DetectInstructionSet();
+
+        return instructionSet;
+    }
+}
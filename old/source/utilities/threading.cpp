@@ -0,0 +1,79 @@
+#include "utilities/threading.hpp"
+
+namespace Mosaic::Internal::Threading
+{
+    ThreadPool::ThreadPool()
+        : ThreadPool(std::max(1u, std::thread::hardware_concurrency()) - 1)
+    {
+    }
+
+    ThreadPool::ThreadPool(Types::UI32 workerCount)
+    {
+        mWorkers.reserve(workerCount);
+
+        for (Types::UI32 index = 0; index < workerCount; index++)
+        {
+            mWorkers.emplace_back([this](std::stop_token stop)
+                                  { WorkerLoop(stop); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        for (auto& worker : mWorkers)
+        {
+            worker.request_stop();
+        }
+
+        mCondition.notify_all();
+
+        mWorkers.clear();
+    }
+
+    Types::UI32 ThreadPool::GetWorkerCount() const
+    {
+        return mWorkers.size();
+    }
+
+    ThreadPool& ThreadPool::GetShared()
+    {
+        static ThreadPool pool;
+
+        return pool;
+    }
+
+    void ThreadPool::Enqueue(std::move_only_function<void()>&& task)
+    {
+        {
+            std::lock_guard lock(mMutex);
+
+            mTasks.push(std::move(task));
+        }
+
+        mCondition.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop(std::stop_token stop)
+    {
+        while (true)
+        {
+            std::move_only_function<void()> task;
+
+            {
+                std::unique_lock lock(mMutex);
+
+                if (not mCondition.wait(lock, stop, [this]
+                                        { return not mTasks.empty(); }))
+                {
+                    return;
+                }
+
+                task = std::move(mTasks.front());
+
+                mTasks.pop();
+            }
+
+            task();
+        }
+    }
+}
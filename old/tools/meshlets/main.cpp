@@ -0,0 +1,166 @@
+#include "rendering/meshlets.hpp"
+
+#include "application/console.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+namespace Mosaic::Tools
+{
+    using namespace Internal;
+    using namespace Internal::Rendering;
+
+    struct BenchmarkMesh
+    {
+        std::vector<Types::F32> Positions;
+        std::vector<Types::UI32> Indices;
+
+        Types::UI64 VertexCount = 0;
+    };
+
+    struct BenchmarkView
+    {
+        const char* Name;
+
+        Types::Vec3<Types::F32> Camera;
+
+        Types::F32 HalfAngle;
+        Types::F32 Far;
+    };
+
+    BenchmarkMesh GenerateSphere(Types::UI32 rings, Types::UI32 segments)
+    {
+        BenchmarkMesh mesh;
+
+        for (Types::UI32 ring = 0; ring <= rings; ring++)
+        {
+            const Types::F32 theta = std::numbers::pi_v<Types::F32> * ring / rings;
+
+            for (Types::UI32 segment = 0; segment <= segments; segment++)
+            {
+                const Types::F32 phi = 2.0f * std::numbers::pi_v<Types::F32> * segment / segments;
+
+                mesh.Positions.push_back(std::sin(theta) * std::cos(phi));
+                mesh.Positions.push_back(std::cos(theta));
+                mesh.Positions.push_back(std::sin(theta) * std::sin(phi));
+            }
+        }
+
+        mesh.VertexCount = mesh.Positions.size() / 3;
+
+        for (Types::UI32 ring = 0; ring < rings; ring++)
+        {
+            for (Types::UI32 segment = 0; segment < segments; segment++)
+            {
+                const Types::UI32 first = ring * (segments + 1) + segment;
+                const Types::UI32 second = first + segments + 1;
+
+                mesh.Indices.insert(mesh.Indices.end(), {first, first + 1, second});
+                mesh.Indices.insert(mesh.Indices.end(), {second, first + 1, second + 1});
+            }
+        }
+
+        return mesh;
+    }
+
+    std::array<Types::Vec4<Types::F32>, 6> GetFrustumPlanes(const BenchmarkView& view)
+    {
+        const Types::F32 sine = std::sin(view.HalfAngle);
+        const Types::F32 cosine = std::cos(view.HalfAngle);
+
+        const std::array<Types::Vec3<Types::F32>, 6> normals = {
+            Types::Vec3<Types::F32>(0.0f, 0.0f, -1.0f),
+            Types::Vec3<Types::F32>(0.0f, 0.0f, 1.0f),
+            Types::Vec3<Types::F32>(cosine, 0.0f, -sine),
+            Types::Vec3<Types::F32>(-cosine, 0.0f, -sine),
+            Types::Vec3<Types::F32>(0.0f, cosine, -sine),
+            Types::Vec3<Types::F32>(0.0f, -cosine, -sine),
+        };
+
+        std::array<Types::Vec4<Types::F32>, 6> planes;
+
+        for (Types::UI32 index = 0; index < normals.size(); index++)
+        {
+            const auto& normal = normals[index];
+
+            const Types::F32 distance = normal.X * view.Camera.X + normal.Y * view.Camera.Y + normal.Z * view.Camera.Z;
+
+            planes[index] = {normal.X, normal.Y, normal.Z, -distance};
+        }
+
+        planes[1].W += view.Far;
+
+        return planes;
+    }
+
+    void RunView(const MeshletData& data, Types::UI64 triangleCount, const BenchmarkView& view, Types::UI32 iterations)
+    {
+        const auto planes = GetFrustumPlanes(view);
+
+        std::vector<Types::UI32> visible;
+
+        MeshletCullStatistics statistics;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (Types::UI32 iteration = 0; iteration < iterations; iteration++)
+        {
+            statistics = Meshlets::Cull(data.GetView(), planes, view.Camera, visible);
+        }
+
+        const Types::F64 cullTime = std::chrono::duration<Types::F64, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        const Types::F64 reduction = 100.0 * (1.0 - static_cast<Types::F64>(statistics.TrianglesVisible) / triangleCount);
+
+        Console::LogSuccess("{}: {} of {} meshlets visible ({} frustum, {} cone rejected), {} of {} triangles submitted ({:.1f}% fewer than whole-object culling), {:.1f}us per cull",
+                            view.Name,
+                            statistics.MeshletsVisible,
+                            statistics.MeshletsTested,
+                            statistics.FrustumRejected,
+                            statistics.ConeRejected,
+                            statistics.TrianglesVisible,
+                            triangleCount,
+                            reduction,
+                            cullTime);
+    }
+}
+
+int main()
+{
+    using namespace Mosaic::Tools;
+
+    constexpr Types::UI32 Iterations = 1000;
+
+    const BenchmarkMesh mesh = GenerateSphere(512, 1024);
+
+    const VertexStreamView positions = {reinterpret_cast<const std::byte*>(mesh.Positions.data()), 3 * sizeof(Types::F32)};
+
+    MeshletData data;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    Meshlets::Build(mesh.Indices, positions, mesh.VertexCount, {}, data);
+
+    const Types::F64 buildTime = std::chrono::duration<Types::F64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const Types::UI64 triangleCount = mesh.Indices.size() / 3;
+
+    Console::LogNotice("Built {} meshlets from {} triangles in {:.1f}ms", data.Meshlets.size(), triangleCount, buildTime);
+
+    const std::array views = {
+        BenchmarkView{"Distant", {0.0f, 0.0f, 4.0f}, 0.6f, 100.0f},
+        BenchmarkView{"Close", {0.0f, 0.0f, 1.5f}, 0.4f, 100.0f},
+        BenchmarkView{"Surface", {0.0f, 0.0f, 1.05f}, 0.5f, 100.0f},
+    };
+
+    for (const BenchmarkView& view : views)
+    {
+        RunView(data, triangleCount, view, Iterations);
+    }
+
+    return 0;
+}
\ No newline at end of file
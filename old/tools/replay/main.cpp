@@ -0,0 +1,152 @@
+#include "application/main.hpp"
+
+#include "rendering/capture.hpp"
+
+#include "utilities/config.hpp"
+
+#include <SDL3/SDL_events.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Mosaic::Tools
+{
+    using namespace Internal;
+
+    class ReplayComponent : public Component
+    {
+    public:
+        ReplayComponent(ComponentManager& componentManager, EventManager& eventManager, Rendering::Renderer& renderer, const std::string& configPath)
+            : Component(componentManager, eventManager), mRenderer(renderer), mCommands(renderer), mConfigPath(configPath), mFrame(0), mIteration(0), mIterations(0)
+        {
+        }
+
+    protected:
+        void Start() override
+        {
+            Files::TOMLFile config;
+
+            config.Open(mConfigPath);
+
+            const auto capture = config.Get<std::string>("Replay.Capture");
+
+            mIterations = config.Get<Types::UI32>("Replay.Iterations", 100);
+
+            mReplay.Load(capture);
+
+            if (mReplay.GetFrameCount() == 0)
+            {
+                Console::Throw("Capture contains no frames: {}", capture);
+            }
+
+            mSendTimes.reserve(mReplay.GetFrameCount() * mIterations);
+
+            mRenderer.SetBackendTiming(true);
+
+            Console::LogNotice("Replaying {} frames from {} for {} iterations", mReplay.GetFrameCount(), capture, mIterations);
+        }
+
+        void Update() override
+        {
+            if (mIteration == mIterations)
+            {
+                SDL_Event event = {.type = SDL_EVENT_QUIT};
+
+                SDL_PushEvent(&event);
+
+                return;
+            }
+
+            mReplay.Submit(mFrame, mCommands);
+
+            const auto start = std::chrono::steady_clock::now();
+
+            mCommands.Send();
+
+            mSendTimes.push_back(std::chrono::duration<Types::F64, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+            if (++mFrame == mReplay.GetFrameCount())
+            {
+                mFrame = 0;
+                mIteration++;
+            }
+        }
+
+        void Stop() override
+        {
+            const std::vector<Types::F64> backendTimes = mRenderer.TakeBackendTimes();
+
+            mRenderer.SetBackendTiming(false);
+
+            std::vector<Types::F64> frameTimes(std::min(mSendTimes.size(), backendTimes.size()));
+
+            if (frameTimes.empty())
+            {
+                return;
+            }
+
+            for (Types::UI64 frame = 0; frame < frameTimes.size(); frame++)
+            {
+                frameTimes[frame] = mSendTimes[frame] + backendTimes[frame];
+            }
+
+            std::ranges::sort(frameTimes);
+
+            const Types::F64 mean = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0) / frameTimes.size();
+            const Types::F64 percentile = frameTimes[(frameTimes.size() - 1) * 95 / 100];
+
+            Console::LogSuccess("Replayed {} frames (send and backend update): mean {:.1f}us, min {:.1f}us, p95 {:.1f}us, max {:.1f}us",
+                                frameTimes.size(),
+                                mean,
+                                frameTimes.front(),
+                                percentile,
+                                frameTimes.back());
+
+            if (mReplay.GetSkippedCommands() > 0)
+            {
+                Console::LogWarning("{} render pass commands could not be reconstructed and were skipped", mReplay.GetSkippedCommands());
+            }
+        }
+
+    private:
+        Rendering::Renderer& mRenderer;
+        Rendering::RendererCommandManager mCommands;
+        Rendering::CommandReplay mReplay;
+
+        std::string mConfigPath;
+
+        std::vector<Types::F64> mSendTimes;
+
+        Types::UI32 mFrame;
+        Types::UI32 mIteration;
+        Types::UI32 mIterations;
+    };
+
+    class ReplayInstance : public Instance
+    {
+    public:
+        ReplayInstance(ComponentManager& componentManager, EventManager& eventManager, Windowing::Window& window, Rendering::Renderer& renderer, const std::string& configPath)
+            : Instance(componentManager, eventManager, window, renderer), mReplay(componentManager, eventManager, renderer, configPath)
+        {
+            window.SetConfigPath(configPath);
+            renderer.SetConfigPath(configPath);
+        }
+
+    private:
+        ReplayComponent mReplay;
+    };
+}
+
+namespace Mosaic::Internal
+{
+    Instance* Instance::ProvideInstance(ComponentManager& componentManager, EventManager& eventManager, Windowing::Window& window, Rendering::Renderer& renderer)
+    {
+        const char* configPath = std::getenv("MOSAIC_REPLAY_CONFIG");
+
+        return new Tools::ReplayInstance(componentManager, eventManager, window, renderer, configPath ? configPath : "replay.toml");
+    }
+}